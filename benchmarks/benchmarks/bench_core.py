@@ -172,3 +172,36 @@ class UnpackBits(Benchmark):
 class Indices(Benchmark):
     def time_indices(self):
         np.indices((1000, 500))
+
+
+class StringOps(Benchmark):
+    params = ['S', 'U']
+    param_names = ['dtype']
+
+    def setup(self, dtype):
+        rnd = np.random.RandomState(42)
+        words = [''.join(rnd.choice(list(' abcdeXYZ'), rnd.randint(1, 12)))
+                 for _ in range(1000)]
+        self.a = np.array(words * 100, dtype=dtype)
+        self.sub = self.a[0][:1]
+
+    def time_str_len(self, dtype):
+        np.char.str_len(self.a)
+
+    def time_find(self, dtype):
+        np.char.find(self.a, self.sub)
+
+    def time_count(self, dtype):
+        np.char.count(self.a, self.sub)
+
+    def time_startswith(self, dtype):
+        np.char.startswith(self.a, self.sub)
+
+    def time_upper(self, dtype):
+        np.char.upper(self.a)
+
+    def time_strip(self, dtype):
+        np.char.strip(self.a)
+
+    def time_replace(self, dtype):
+        np.char.replace(self.a, self.sub, self.sub * 2)
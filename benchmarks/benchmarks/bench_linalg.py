@@ -73,6 +73,27 @@ class Eindot(Benchmark):
         np.tensordot(self.a3, self.b3, axes=([1, 0], [0, 1]))
 
 
+class MatmulTypes(Benchmark):
+    # types without BLAS, which use the blocked matrix product
+    params = [['int8', 'int32', 'int64', 'float16', 'longdouble'],
+              [64, 256]]
+    param_names = ['type', 'size']
+
+    def setup(self, typename, size):
+        rng = np.random.RandomState(0)
+        self.a = rng.randint(0, 10, size=(size, size)).astype(typename)
+        self.at = self.a.T
+
+    def time_dot(self, typename, size):
+        np.dot(self.a, self.a)
+
+    def time_dot_trans(self, typename, size):
+        np.dot(self.a, self.at)
+
+    def time_matmul(self, typename, size):
+        np.matmul(self.a, self.a)
+
+
 class Linalg(Benchmark):
     params = [['svd', 'pinv', 'det', 'norm'],
               TYPES1]
@@ -100,6 +121,27 @@ class Linalg(Benchmark):
         self.func(self.a)
 
 
+class LinalgLarge(Benchmark):
+    # dominated by the level 3 BLAS inside LAPACK, which makes the
+    # difference between lapack_lite and an optimized BLAS visible
+    params = [['inv', 'solve', 'det', 'cholesky'],
+              [100, 200, 500]]
+    param_names = ['op', 'size']
+
+    def setup(self, op, size):
+        a = np.random.RandomState(0).rand(size, size)
+        if op == 'cholesky':
+            self.a = np.dot(a, a.T) + size * np.eye(size)
+        else:
+            self.a = a
+
+    def time_op(self, op, size):
+        if op == 'solve':
+            np.linalg.solve(self.a, self.a)
+        else:
+            getattr(np.linalg, op)(self.a)
+
+
 class Lstsq(Benchmark):
     def setup(self):
         self.a = get_squares_()['float64']
@@ -134,6 +134,43 @@ class CustomScalar(Benchmark):
         (self.d < 1)
 
 
+class SmallArray(Benchmark):
+    # The per call overhead of ufuncs on arrays small enough for it to
+    # dominate the time spent in the inner loop.
+    params = [[1, 10, 100], ['int64', 'float64', 'complex128']]
+    param_names = ['size', 'dtype']
+
+    def setup(self, size, dtype):
+        self.a = np.arange(1, size + 1, dtype=dtype)
+        self.b = np.arange(size, dtype=dtype)
+        self.s = np.array(2, dtype=dtype)
+        self.a_strided = np.arange(2 * size, dtype=dtype)[::2]
+
+    def time_add(self, size, dtype):
+        np.add(self.a, self.b)
+
+    def time_add_operator(self, size, dtype):
+        (self.a + self.b)
+
+    def time_add_0d(self, size, dtype):
+        np.add(self.a, self.s)
+
+    def time_multiply_strided(self, size, dtype):
+        np.multiply(self.a_strided, self.a_strided)
+
+    def time_negative(self, size, dtype):
+        np.negative(self.a)
+
+    def time_equal(self, size, dtype):
+        (self.a == self.b)
+
+    def time_sqrt(self, size, dtype):
+        np.sqrt(self.a)
+
+    def time_add_out(self, size, dtype):
+        np.add(self.a, self.b, out=self.b)
+
+
 class Scalar(Benchmark):
     def setup(self):
         self.x = np.asarray(1.0)
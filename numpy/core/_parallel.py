@@ -0,0 +1,53 @@
+"""
+Splitting the work on large arrays between threads.
+
+Used by functions whose C loops release the GIL, so that blocks of the work
+run concurrently. Running in several threads is opt-in: the number of threads
+is read from an environment variable and is one if that is not set.
+
+"""
+from __future__ import division, absolute_import, print_function
+
+import os
+import threading
+
+
+def thread_count(name):
+    """
+    Return the number of threads set by the environment variable `name`,
+    or 1 if it is not set or not an integer.
+    """
+    try:
+        return max(1, int(os.environ[name]))
+    except (KeyError, ValueError):
+        return 1
+
+
+def run_blocks(func, length, nthreads):
+    """
+    Call ``func(start, stop)`` on `nthreads` consecutive blocks that cover
+    ``range(length)``.
+
+    The first block is run in the calling thread and every other block in a
+    thread of its own. `func` is expected to write its results into a
+    preallocated output. The first exception raised by any block is re-raised
+    once all the threads are done.
+    """
+    bounds = [length * i // nthreads for i in range(nthreads + 1)]
+    errors = []
+
+    def worker(i):
+        try:
+            func(bounds[i], bounds[i + 1])
+        except BaseException as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker, args=(i,))
+               for i in range(1, nthreads)]
+    for t in threads:
+        t.start()
+    worker(0)
+    for t in threads:
+        t.join()
+    if errors:
+        raise errors[0]
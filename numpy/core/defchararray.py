@@ -1067,9 +1067,9 @@ def replace(a, old, new, count=None):
     str.replace
 
     """
-    return _to_string_or_unicode_array(
-        _vec_string(
-            a, object_, 'replace', [old, new] + _clean_args(count)))
+    a_arr = numpy.asarray(a)
+    return _vec_string(
+        a_arr, a_arr.dtype.type, 'replace', [old, new] + _clean_args(count))
 
 
 def rfind(a, sub, start=0, end=None):
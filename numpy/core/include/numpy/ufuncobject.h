@@ -209,6 +209,13 @@ typedef struct _tagPyUFuncObject {
          * set by nditer object.
          */
         npy_uint32 iter_flags;
+
+        /*
+         * Loops recently selected by the default type resolver, for
+         * the operand types they were selected for. Private to NumPy,
+         * allocated on first use and cleared when loops are registered.
+         */
+        void *type_resolution_cache;
 } PyUFuncObject;
 
 #include "arrayobject.h"
@@ -0,0 +1,13 @@
+#ifndef _NPY_BLOCKED_MATMUL_H_
+#define _NPY_BLOCKED_MATMUL_H_
+
+NPY_NO_EXPORT int
+blocked_matmul_supported(int typenum, npy_intp m, npy_intp n, npy_intp p);
+
+NPY_NO_EXPORT int
+blocked_matmul(int typenum, npy_intp m, npy_intp n, npy_intp p,
+               char *ip1, npy_intp is1_m, npy_intp is1_p,
+               char *ip2, npy_intp is2_p, npy_intp is2_n,
+               char *op, npy_intp os_m, npy_intp os_n);
+
+#endif
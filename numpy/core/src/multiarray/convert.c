@@ -72,6 +72,9 @@ npy_fallocate(npy_intp nbytes, FILE * fp)
     return 0;
 }
 
+/* size of the staging buffer used when writing non-contiguous arrays */
+#define TOFILE_BUFSIZE (1024 * 1024)
+
 /*
  * Converts a subarray of 'self' into lists, with starting data pointer
  * 'dataptr' and from dimension 'startdim' to the last dimension of 'self'.
@@ -192,24 +195,52 @@ PyArray_ToFile(PyArrayObject *self, FILE *fp, char *sep, char *format)
             }
         }
         else {
+            /*
+             * Gather the elements into a staging buffer and write that out
+             * in large blocks rather than issuing one fwrite per element.
+             */
+            npy_intp elsize = PyArray_DESCR(self)->elsize;
+            npy_intp bufsize = PyArray_MAX(TOFILE_BUFSIZE / elsize, 1);
+            npy_intp nbuf;
+            char *buf, *bptr;
             NPY_BEGIN_THREADS_DEF;
 
             it = (PyArrayIterObject *) PyArray_IterNew((PyObject *)self);
+            if (it == NULL) {
+                return -1;
+            }
+            bufsize = PyArray_MAX(PyArray_MIN(bufsize, it->size), 1);
+            buf = PyArray_malloc(bufsize * elsize);
+            if (buf == NULL) {
+                Py_DECREF(it);
+                PyErr_NoMemory();
+                return -1;
+            }
             NPY_BEGIN_THREADS;
             while (it->index < it->size) {
-                if (fwrite((const void *)it->dataptr,
-                            (size_t) PyArray_DESCR(self)->elsize,
-                            1, fp) < 1) {
+                npy_intp first = it->index;
+
+                bptr = buf;
+                for (nbuf = 0; nbuf < bufsize && it->index < it->size;
+                        nbuf++) {
+                    memcpy(bptr, it->dataptr, elsize);
+                    bptr += elsize;
+                    PyArray_ITER_NEXT(it);
+                }
+                n = fwrite((const void *)buf, (size_t) elsize,
+                           (size_t) nbuf, fp);
+                if (n < nbuf) {
                     NPY_END_THREADS;
                     PyErr_Format(PyExc_IOError,
                             "problem writing element %" NPY_INTP_FMT
-                            " to file", it->index);
+                            " to file", first + n);
+                    PyArray_free(buf);
                     Py_DECREF(it);
                     return -1;
                 }
-                PyArray_ITER_NEXT(it);
             }
             NPY_END_THREADS;
+            PyArray_free(buf);
             Py_DECREF(it);
         }
     }
@@ -31,6 +31,10 @@
 
 #include "get_attr_string.h"
 
+#if defined(HAVE_POSIX_FADVISE)
+#include <fcntl.h>
+#endif
+
 /*
  * Reading from a file or a string.
  *
@@ -3288,12 +3292,39 @@ PyArray_ArangeObj(PyObject *start, PyObject *stop, PyObject *step, PyArray_Descr
     return NULL;
 }
 
+/*
+ * Binary reads are split into chunks of this many bytes, so that the kernel
+ * can be asked to read ahead the next chunk while the current one is being
+ * copied out of the page cache.
+ */
+#define FROMFILE_CHUNKSIZE (16 * 1024 * 1024)
+
+/*
+ * Hint to the OS that the ``len`` bytes of ``fp`` following ``offset`` will
+ * be read soon (``willneed``) or sequentially. Errors are ignored, this is
+ * purely advisory.
+ */
+static void
+npy_fadvise(FILE *fp, npy_off_t offset, npy_off_t len, int willneed)
+{
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+    if (offset < 0 || len <= 0) {
+        return;
+    }
+    posix_fadvise(fileno(fp), (off_t)offset, (off_t)len,
+                  willneed ? POSIX_FADV_WILLNEED : POSIX_FADV_SEQUENTIAL);
+#endif
+}
+
 static PyArrayObject *
 array_fromfile_binary(FILE *fp, PyArray_Descr *dtype, npy_intp num, size_t *nread)
 {
     PyArrayObject *r;
     npy_off_t start, numbytes;
+    npy_intp chunk, done;
+    char *dptr;
 
+    start = -1;
     if (num < 0) {
         int fail = 0;
         start = npy_ftell(fp);
@@ -3331,11 +3362,38 @@ array_fromfile_binary(FILE *fp, PyArray_Descr *dtype, npy_intp num, size_t *nrea
         return NULL;
     }
     NPY_BEGIN_ALLOW_THREADS;
-    *nread = fread(PyArray_DATA(r), dtype->elsize, num, fp);
+    if (start < 0) {
+        start = npy_ftell(fp);
+    }
+    npy_fadvise(fp, start, (npy_off_t)num * dtype->elsize, 0);
+
+    chunk = PyArray_MAX(FROMFILE_CHUNKSIZE / dtype->elsize, 1);
+    dptr = PyArray_DATA(r);
+    done = 0;
+    *nread = 0;
+    while (done < num) {
+        npy_intp n = PyArray_MIN(chunk, num - done);
+        size_t got;
+
+        /* start prefetching the chunk after this one */
+        if (start >= 0 && done + n < num) {
+            npy_fadvise(fp, start + (npy_off_t)(done + n) * dtype->elsize,
+                        (npy_off_t)PyArray_MIN(chunk, num - done - n) *
+                        dtype->elsize, 1);
+        }
+        got = fread(dptr, dtype->elsize, n, fp);
+        *nread += got;
+        if (got < (size_t)n) {
+            break;
+        }
+        done += n;
+        dptr += n * dtype->elsize;
+    }
     NPY_END_ALLOW_THREADS;
     Py_DECREF(dtype);
     return r;
 }
+#undef FROMFILE_CHUNKSIZE
 
 /*
  * Create an array by reading from the given stream, using the passed
@@ -56,6 +56,8 @@ NPY_NO_EXPORT int NPY_NUMUSERTYPES = 0;
 #include "common.h"
 #include "ufunc_override.h"
 #include "multiarraymodule.h"
+#include "blocked_matmul.h"
+#include "vec_string.h"
 #include "cblasfuncs.h"
 #include "vdot.h"
 #include "templ_common.h" /* for npy_mul_with_overflow_intp */
@@ -1086,6 +1088,29 @@ PyArray_MatrixProduct2(PyObject *op1, PyObject *op2, PyArrayObject* out)
 
     op = PyArray_DATA(out_buf);
     os = PyArray_DESCR(out_buf)->elsize;
+
+    if (PyArray_NDIM(ap1) == 2 && PyArray_NDIM(ap2) == 2 &&
+            blocked_matmul_supported(typenum, PyArray_DIM(ap1, 0),
+                                     PyArray_DIM(ap2, 1), l)) {
+        int blocked_failed;
+
+        NPY_BEGIN_THREADS;
+        blocked_failed = blocked_matmul(typenum,
+                                        PyArray_DIM(ap1, 0),
+                                        PyArray_DIM(ap2, 1), l,
+                                        PyArray_DATA(ap1),
+                                        PyArray_STRIDE(ap1, 0), is1,
+                                        PyArray_DATA(ap2),
+                                        is2, PyArray_STRIDE(ap2, 1),
+                                        op, PyArray_STRIDE(out_buf, 0),
+                                        PyArray_STRIDE(out_buf, 1));
+        NPY_END_THREADS;
+        if (!blocked_failed) {
+            goto finish;
+        }
+        /* out of memory for the packed operands, use the dot function */
+    }
+
     axis = PyArray_NDIM(ap1)-1;
     it1 = (PyArrayIterObject *)
         PyArray_IterAllButAxis((PyObject *)ap1, &axis);
@@ -1115,6 +1140,8 @@ PyArray_MatrixProduct2(PyObject *op1, PyObject *op2, PyArrayObject* out)
         /* only for OBJECT arrays */
         goto fail;
     }
+
+finish:
     Py_DECREF(ap1);
     Py_DECREF(ap2);
 
@@ -2488,6 +2515,20 @@ array_matmul(PyObject *NPY_UNUSED(m), PyObject *args, PyObject* kwds)
     }
 #endif
 
+    /* Large matrices of the other types use the blocked matrix product */
+    if (nd1 == 2 && nd2 == 2 && out == NULL &&
+            PyArray_CheckExact(ap1) && PyArray_CheckExact(ap2) &&
+            PyArray_DIM(ap1, 1) == PyArray_DIM(ap2, 0) &&
+            blocked_matmul_supported(typenum, PyArray_DIM(ap1, 0),
+                                     PyArray_DIM(ap2, 1),
+                                     PyArray_DIM(ap1, 1))) {
+        ret = (PyArrayObject *)PyArray_MatrixProduct2((PyObject *)ap1,
+                                                      (PyObject *)ap2, NULL);
+        Py_DECREF(ap1);
+        Py_DECREF(ap2);
+        return (PyObject *)ret;
+    }
+
     /*
      * Use einsum for the stacked cases. This is a quick implementation
      * to avoid setting up the proper iterators. Einsum broadcasts, so
@@ -3990,6 +4031,7 @@ _vec_string(PyObject *NPY_UNUSED(dummy), PyObject *args, PyObject *kwds)
 
     PyObject* method = NULL;
     PyObject* result = NULL;
+    int fit = 0;
 
     if (!PyArg_ParseTuple(args, "O&O&O|O",
                 PyArray_Converter, &char_array,
@@ -3998,16 +4040,42 @@ _vec_string(PyObject *NPY_UNUSED(dummy), PyObject *args, PyObject *kwds)
         goto err;
     }
 
+    if (PyArray_TYPE(char_array) != NPY_STRING &&
+            PyArray_TYPE(char_array) != NPY_UNICODE) {
+        PyErr_SetString(PyExc_TypeError,
+                "string operation on non-string array");
+        goto err;
+    }
+
+    /* the common methods are implemented on the buffers directly */
+    result = vec_string_native(char_array, type, method_name, args_seq);
+    if (result != Py_NotImplemented) {
+        Py_DECREF(type);
+        if (result == NULL) {
+            goto err;
+        }
+        Py_DECREF(char_array);
+        return result;
+    }
+    Py_DECREF(result);
+    result = NULL;
+
+    /*
+     * An unsized string or unicode type asks for a result sized to fit,
+     * which is found from a list of the results like np.asarray does.
+     */
+    if (PyDataType_ISUNSIZED(type) &&
+            (type->type_num == NPY_STRING || type->type_num == NPY_UNICODE)) {
+        Py_DECREF(type);
+        type = PyArray_DescrFromType(NPY_OBJECT);
+        fit = 1;
+    }
+
     if (PyArray_TYPE(char_array) == NPY_STRING) {
         method = PyObject_GetAttr((PyObject *)&PyString_Type, method_name);
     }
-    else if (PyArray_TYPE(char_array) == NPY_UNICODE) {
-        method = PyObject_GetAttr((PyObject *)&PyUnicode_Type, method_name);
-    }
     else {
-        PyErr_SetString(PyExc_TypeError,
-                "string operation on non-string array");
-        goto err;
+        method = PyObject_GetAttr((PyObject *)&PyUnicode_Type, method_name);
     }
     if (method == NULL) {
         goto err;
@@ -4028,6 +4096,19 @@ _vec_string(PyObject *NPY_UNUSED(dummy), PyObject *args, PyObject *kwds)
     if (result == NULL) {
         goto err;
     }
+    if (fit) {
+        PyObject *list = PyArray_ToList((PyArrayObject *)result);
+
+        Py_DECREF(result);
+        if (list == NULL) {
+            goto err;
+        }
+        result = PyArray_FROM_O(list);
+        Py_DECREF(list);
+        if (result == NULL) {
+            goto err;
+        }
+    }
 
     Py_DECREF(char_array);
     Py_DECREF(method);
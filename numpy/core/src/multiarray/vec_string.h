@@ -0,0 +1,8 @@
+#ifndef _NPY_VEC_STRING_H_
+#define _NPY_VEC_STRING_H_
+
+NPY_NO_EXPORT PyObject *
+vec_string_native(PyArrayObject *char_array, PyArray_Descr *type,
+                  PyObject *method_name, PyObject *args);
+
+#endif
@@ -124,6 +124,15 @@ binop_should_defer(PyObject *self, PyObject *other, int inplace)
         PyArray_CheckAnyScalarExact(other)) {
         return 0;
     }
+    /*
+     * Builtin types like float and int have neither __array_ufunc__ nor
+     * __array_priority__, so ndarray and the numpy scalars, whose priority
+     * is at least the default, never defer to them.
+     */
+    if (_is_basic_python_type(Py_TYPE(other)) &&
+            (PyArray_CheckExact(self) || PyArray_CheckAnyScalarExact(self))) {
+        return 0;
+    }
     /*
      * Classes with __array_ufunc__ are living in the future, and only need to
      * check whether __array_ufunc__ equals None.
@@ -4357,6 +4357,170 @@ handle_out:
 }
 
 
+/*
+ * Calls the ufunc without the argument parsing, extobj lookup, override,
+ * __array_prepare__/__array_wrap__ and iterator machinery, which cost far
+ * more than the inner loop for small arrays. This applies when there are
+ * no keyword arguments and no outputs, all the inputs are exact, aligned,
+ * native byte order ndarrays of boolean or numeric type whose dtypes the
+ * selected loop uses as they are, and the inputs that are not 0-d have the
+ * same shape and are either C contiguous or one dimensional with a
+ * non-negative stride. Exact ndarrays never override the ufunc, and the
+ * result is exactly what the general path returns for such inputs: the
+ * outputs are C contiguous and 0-d outputs are converted to scalars.
+ *
+ * The error mode set with np.seterr is only looked up when the loop set a
+ * floating point error flag.
+ *
+ * Returns 1 with the result in *ret if the call was done, 0 if the general
+ * path has to be taken and -1 if there is an error.
+ */
+static int
+ufunc_fast_call(PyUFuncObject *ufunc, PyObject *args, PyObject *kwds,
+                PyObject **ret)
+{
+    int nin = ufunc->nin, nout = ufunc->nout, nop = nin + nout;
+    int i, ndim = 0, needs_api = 0, retval = -1;
+    npy_intp *shape = NULL, count = 1;
+    PyArrayObject *op[NPY_MAXARGS];
+    PyArray_Descr *dtypes[NPY_MAXARGS];
+    char *dataptrs[NPY_MAXARGS];
+    npy_intp counts[NPY_MAXARGS], strides[NPY_MAXARGS];
+    PyUFuncGenericFunction innerloop;
+    void *innerloopdata;
+    const char *ufunc_name;
+    NPY_BEGIN_THREADS_DEF;
+
+    if (ufunc->core_enabled || nin == 0 ||
+            PyTuple_GET_SIZE(args) != nin ||
+            (kwds != NULL && PyDict_Size(kwds) != 0)) {
+        return 0;
+    }
+    for (i = 0; i < nin; ++i) {
+        PyArrayObject *arr = (PyArrayObject *)PyTuple_GET_ITEM(args, i);
+        int type_num;
+
+        if (!PyArray_CheckExact(arr)) {
+            return 0;
+        }
+        type_num = PyArray_DESCR(arr)->type_num;
+        if (!(PyTypeNum_ISBOOL(type_num) || PyTypeNum_ISNUMBER(type_num)) ||
+                !PyArray_ISNBO(PyArray_DESCR(arr)->byteorder) ||
+                !PyArray_ISALIGNED(arr)) {
+            return 0;
+        }
+        if (PyArray_NDIM(arr) > 0) {
+            if (!PyArray_IS_C_CONTIGUOUS(arr) &&
+                    !(PyArray_NDIM(arr) == 1 && PyArray_STRIDE(arr, 0) >= 0)) {
+                return 0;
+            }
+            if (shape == NULL) {
+                ndim = PyArray_NDIM(arr);
+                shape = PyArray_DIMS(arr);
+                count = PyArray_SIZE(arr);
+            }
+            else if (PyArray_NDIM(arr) != ndim ||
+                     !PyArray_CompareLists(shape, PyArray_DIMS(arr), ndim)) {
+                return 0;
+            }
+        }
+        op[i] = arr;
+    }
+    for (i = nin; i < nop; ++i) {
+        op[i] = NULL;
+    }
+
+    if (ufunc->type_resolver(ufunc, NPY_DEFAULT_ASSIGN_CASTING,
+                             op, NULL, dtypes) < 0) {
+        return -1;
+    }
+    for (i = 0; i < nin; ++i) {
+        if (!PyArray_EquivTypes(dtypes[i], PyArray_DESCR(op[i]))) {
+            retval = 0;
+            goto finish;
+        }
+    }
+    if (ufunc->legacy_inner_loop_selector(ufunc, dtypes,
+                    &innerloop, &innerloopdata, &needs_api) < 0) {
+        goto finish;
+    }
+    if (_does_loop_use_arrays(innerloopdata)) {
+        retval = 0;
+        goto finish;
+    }
+
+    for (i = 0; i < nop; ++i) {
+        counts[i] = count;
+        if (i >= nin) {
+            Py_INCREF(dtypes[i]);
+            op[i] = (PyArrayObject *)PyArray_NewFromDescr(&PyArray_Type,
+                                            dtypes[i], ndim, shape,
+                                            NULL, NULL, 0, NULL);
+            if (op[i] == NULL) {
+                goto finish;
+            }
+        }
+        dataptrs[i] = PyArray_BYTES(op[i]);
+        if (PyArray_NDIM(op[i]) == 0) {
+            strides[i] = 0;
+        }
+        else if (PyArray_NDIM(op[i]) == 1) {
+            strides[i] = PyArray_STRIDE(op[i], 0);
+        }
+        else {
+            strides[i] = PyArray_ITEMSIZE(op[i]);
+        }
+    }
+
+    /* Start with the floating-point exception flags cleared */
+    npy_clear_floatstatus_barrier((char*)&ufunc);
+
+    if (!needs_api) {
+        NPY_BEGIN_THREADS_THRESHOLDED(count);
+    }
+    innerloop(dataptrs, counts, strides, innerloopdata);
+    NPY_END_THREADS;
+
+    if (PyErr_Occurred()) {
+        goto finish;
+    }
+    if (npy_get_floatstatus_barrier((char*)&ufunc)) {
+        int buffersize, errormask;
+
+        ufunc_name = ufunc_get_name_cstr(ufunc);
+        if (_get_bufsize_errmask(NULL, ufunc_name,
+                                 &buffersize, &errormask) < 0 ||
+                _check_ufunc_fperr(errormask, NULL, ufunc_name) < 0) {
+            goto finish;
+        }
+    }
+
+    if (nout == 1) {
+        *ret = PyArray_Return(op[nin]);
+        op[nin] = NULL;
+    }
+    else {
+        *ret = PyTuple_New(nout);
+        if (*ret == NULL) {
+            goto finish;
+        }
+        for (i = 0; i < nout; i++) {
+            PyTuple_SET_ITEM(*ret, i, PyArray_Return(op[nin + i]));
+            op[nin + i] = NULL;
+        }
+    }
+    retval = 1;
+
+finish:
+    for (i = 0; i < nop; ++i) {
+        Py_DECREF(dtypes[i]);
+    }
+    for (i = nin; i < nop; ++i) {
+        Py_XDECREF(op[i]);
+    }
+    return retval;
+}
+
 static PyObject *
 ufunc_generic_call(PyUFuncObject *ufunc, PyObject *args, PyObject *kwds)
 {
@@ -4364,10 +4528,18 @@ ufunc_generic_call(PyUFuncObject *ufunc, PyObject *args, PyObject *kwds)
     PyArrayObject *mps[NPY_MAXARGS];
     PyObject *retobj[NPY_MAXARGS];
     PyObject *wraparr[NPY_MAXARGS];
-    PyObject *override = NULL;
+    PyObject *override = NULL, *result = NULL;
     ufunc_full_args full_args = {NULL, NULL};
     int errval;
 
+    errval = ufunc_fast_call(ufunc, args, kwds, &result);
+    if (errval < 0) {
+        return NULL;
+    }
+    else if (errval) {
+        return result;
+    }
+
     errval = PyUFunc_CheckOverride(ufunc, "__call__", args, kwds, &override);
     if (errval) {
         return NULL;
@@ -4586,6 +4758,7 @@ PyUFunc_ReplaceLoopBySignature(PyUFuncObject *func,
             *oldfunc = func->functions[i];
         }
         func->functions[i] = newfunc;
+        ufunc_clear_type_resolution_cache(func);
         res = 0;
         break;
     }
@@ -4663,6 +4836,7 @@ PyUFunc_FromFuncAndDataAndSignature(PyUFuncGenericFunction *func, void **data,
     memset(ufunc->op_flags, 0, sizeof(npy_uint32)*ufunc->nargs);
 
     ufunc->iter_flags = 0;
+    ufunc->type_resolution_cache = NULL;
 
     /* generalized ufunc */
     ufunc->core_enabled = 0;
@@ -4911,6 +5085,7 @@ PyUFunc_RegisterLoopForType(PyUFuncObject *ufunc,
     }
     Py_DECREF(descr);
 
+    ufunc_clear_type_resolution_cache(ufunc);
     if (ufunc->userloops == NULL) {
         ufunc->userloops = PyDict_New();
     }
@@ -5021,6 +5196,7 @@ ufunc_dealloc(PyUFuncObject *ufunc)
     PyArray_free(ufunc->core_signature);
     PyArray_free(ufunc->ptr);
     PyArray_free(ufunc->op_flags);
+    ufunc_clear_type_resolution_cache(ufunc);
     Py_XDECREF(ufunc->userloops);
     Py_XDECREF(ufunc->obj);
     PyArray_free(ufunc);
@@ -1941,6 +1941,180 @@ should_use_min_scalar(PyArrayObject **op, int nop)
     return use_min_scalar;
 }
 
+/*
+ * The linear search below is slow compared to the inner loops on small
+ * arrays, so the loops it selects are cached per ufunc for the last few
+ * combinations of operand types. The key records everything that
+ * ufunc_loop_matches looks at for the built-in loops: the casting rules,
+ * any_object and use_min_scalar, and for each operand its type number
+ * and byte order, and for 0-d inputs checked by value, the type number
+ * from min_scalar_type and whether that unsigned value would also fit
+ * the signed type of the same size. The output dtypes are still set for
+ * every call from the operands, to keep their metadata.
+ */
+#define TYPE_RESOLUTION_CACHE_SIZE 8
+#define TYPE_RESOLUTION_CACHE_MAXARGS 4
+
+typedef struct {
+    /* flags, then one code per operand, zero for missing outputs */
+    npy_uint32 key[TYPE_RESOLUTION_CACHE_MAXARGS + 1];
+    /* index of the loop in ufunc->types */
+    int loop;
+} type_resolution_cache_entry;
+
+typedef struct {
+    type_resolution_cache_entry entries[TYPE_RESOLUTION_CACHE_SIZE];
+    int used;
+    /* entry to replace next */
+    int next;
+} type_resolution_cache;
+
+static int
+unsigned_to_signed_type_num(int type_num)
+{
+    switch (type_num) {
+        case NPY_UBYTE:
+            return NPY_BYTE;
+        case NPY_USHORT:
+            return NPY_SHORT;
+        case NPY_UINT:
+            return NPY_INT;
+        case NPY_ULONG:
+            return NPY_LONG;
+        case NPY_ULONGLONG:
+            return NPY_LONGLONG;
+        default:
+            return type_num;
+    }
+}
+
+/*
+ * Fills in the cache key for the operands. Returns 1 on success, 0 if
+ * the operands have types for which the key is not enough to determine
+ * the loop, and -1 on error.
+ */
+static int
+type_resolution_cache_key(PyUFuncObject *self, PyArrayObject **op,
+                          NPY_CASTING input_casting,
+                          NPY_CASTING output_casting,
+                          int any_object, int use_min_scalar,
+                          npy_uint32 *key)
+{
+    int i, nin = self->nin, nop = nin + self->nout;
+
+    if (nop > TYPE_RESOLUTION_CACHE_MAXARGS) {
+        return 0;
+    }
+    memset(key, 0, (TYPE_RESOLUTION_CACHE_MAXARGS + 1) * sizeof(*key));
+    key[0] = (npy_uint32)input_casting | (npy_uint32)output_casting << 4 |
+             (npy_uint32)(any_object != 0) << 8 |
+             (npy_uint32)(use_min_scalar != 0) << 9;
+
+    for (i = 0; i < nop; ++i) {
+        PyArray_Descr *descr;
+        int type_num;
+        npy_uint32 code;
+
+        if (op[i] == NULL) {
+            continue;
+        }
+        descr = PyArray_DESCR(op[i]);
+        type_num = descr->type_num;
+        /* user types have their own loops, others casts depending on more */
+        if (type_num >= NPY_NTYPES || PyTypeNum_ISFLEXIBLE(type_num) ||
+                PyTypeNum_ISDATETIME(type_num)) {
+            return 0;
+        }
+        code = (npy_uint32)(type_num + 1) |
+               (npy_uint32)PyArray_ISNBO(descr->byteorder) << 8;
+
+        if (i < nin && use_min_scalar && PyArray_NDIM(op[i]) == 0 &&
+                PyTypeNum_ISNUMBER(type_num)) {
+            PyArray_Descr *min_descr = PyArray_MinScalarType(op[i]);
+            int min_type_num, signed_type_num;
+
+            if (min_descr == NULL) {
+                return -1;
+            }
+            min_type_num = min_descr->type_num;
+            Py_DECREF(min_descr);
+            code |= (npy_uint32)(min_type_num + 1) << 9;
+
+            signed_type_num = unsigned_to_signed_type_num(min_type_num);
+            if (signed_type_num != min_type_num) {
+                PyArray_Descr *signed_descr =
+                                    PyArray_DescrFromType(signed_type_num);
+                if (signed_descr == NULL) {
+                    return -1;
+                }
+                if (PyArray_CanCastArrayTo(op[i], signed_descr,
+                                           NPY_SAFE_CASTING)) {
+                    code |= (npy_uint32)1 << 17;
+                }
+                Py_DECREF(signed_descr);
+            }
+        }
+        key[i + 1] = code;
+    }
+    return 1;
+}
+
+/* Returns the cached loop index for the key, or -1 */
+static int
+type_resolution_cache_lookup(PyUFuncObject *self, const npy_uint32 *key)
+{
+    type_resolution_cache *cache = self->type_resolution_cache;
+    int i;
+
+    if (cache == NULL) {
+        return -1;
+    }
+    for (i = 0; i < cache->used; ++i) {
+        if (memcmp(cache->entries[i].key, key,
+                   sizeof(cache->entries[i].key)) == 0) {
+            return cache->entries[i].loop;
+        }
+    }
+    return -1;
+}
+
+static void
+type_resolution_cache_store(PyUFuncObject *self, const npy_uint32 *key,
+                            int loop)
+{
+    type_resolution_cache *cache = self->type_resolution_cache;
+    type_resolution_cache_entry *entry;
+
+    if (cache == NULL) {
+        cache = PyArray_malloc(sizeof(*cache));
+        if (cache == NULL) {
+            /* caching is only an optimization */
+            return;
+        }
+        cache->used = 0;
+        cache->next = 0;
+        self->type_resolution_cache = cache;
+    }
+    entry = &cache->entries[cache->next];
+    memcpy(entry->key, key, sizeof(entry->key));
+    entry->loop = loop;
+    cache->next = (cache->next + 1) % TYPE_RESOLUTION_CACHE_SIZE;
+    if (cache->used < TYPE_RESOLUTION_CACHE_SIZE) {
+        cache->used++;
+    }
+}
+
+/*
+ * Forgets the loops cached for the ufunc, which must be done whenever
+ * its loops change.
+ */
+NPY_NO_EXPORT void
+ufunc_clear_type_resolution_cache(PyUFuncObject *ufunc)
+{
+    PyArray_free(ufunc->type_resolution_cache);
+    ufunc->type_resolution_cache = NULL;
+}
+
 /*
  * Does a linear search for the best inner loop of the ufunc.
  *
@@ -1958,7 +2132,8 @@ linear_search_type_resolver(PyUFuncObject *self,
     npy_intp i, j, nin = self->nin, nop = nin + self->nout;
     int types[NPY_MAXARGS];
     const char *ufunc_name;
-    int no_castable_output, use_min_scalar;
+    int no_castable_output, use_min_scalar, cacheable;
+    npy_uint32 key[TYPE_RESOLUTION_CACHE_MAXARGS + 1];
 
     /* For making a better error message on coercion error */
     char err_dst_typecode = '-', err_src_typecode = '-';
@@ -1967,6 +2142,25 @@ linear_search_type_resolver(PyUFuncObject *self,
 
     use_min_scalar = should_use_min_scalar(op, nin);
 
+    cacheable = type_resolution_cache_key(self, op,
+                                input_casting, output_casting,
+                                any_object, use_min_scalar, key);
+    if (cacheable < 0) {
+        return -1;
+    }
+    if (cacheable) {
+        int loop = type_resolution_cache_lookup(self, key);
+        if (loop >= 0) {
+            char *orig_types = self->types + loop*self->nargs;
+
+            for (j = 0; j < nop; ++j) {
+                types[j] = orig_types[j];
+            }
+            return set_ufunc_loop_data_types(self, op, out_dtype, types,
+                                             NULL);
+        }
+    }
+
     /* If the ufunc has userloops, search for them. */
     if (self->userloops) {
         switch (linear_search_userloop_type_resolver(self, op,
@@ -2019,6 +2213,9 @@ linear_search_type_resolver(PyUFuncObject *self,
                 return -1;
             /* Found a match */
             case 1:
+                if (cacheable) {
+                    type_resolution_cache_store(self, key, (int)i);
+                }
                 set_ufunc_loop_data_types(self, op, out_dtype, types, NULL);
                 return 0;
         }
@@ -92,6 +92,10 @@ PyUFunc_DivisionTypeResolver(PyUFuncObject *ufunc,
                              PyObject *type_tup,
                              PyArray_Descr **out_dtypes);
 
+/* Forgets the loops cached for the ufunc, whenever its loops change. */
+NPY_NO_EXPORT void
+ufunc_clear_type_resolution_cache(PyUFuncObject *ufunc);
+
 /*
  * Does a linear search for the best inner loop of the ufunc.
  *
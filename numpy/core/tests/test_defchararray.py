@@ -6,6 +6,7 @@ import numpy as np
 from numpy.core.multiarray import _vec_string
 from numpy.testing import (
     assert_, assert_equal, assert_array_equal, assert_raises,
+    assert_raises_regex,
     suppress_warnings,
     )
 
@@ -133,6 +134,70 @@ class TestVecString(object):
 
         assert_raises(ValueError, fail)
 
+    def test_native_methods(self):
+        # The common methods are computed on the buffers rather than by
+        # calling the str methods, check they agree on awkward inputs
+        strings = [u'', u'a', u'abcab', u' \tab c\n', u'a\x00b', u'aaaa',
+                   u'x\x1c\x85 ', u'\xe9t\xe9', u'stra\xdfe', u'\u03a3\u03a3']
+        for dt in ['U9', 'S9']:
+            if dt == 'U9':
+                conv = lambda s: s
+            else:
+                conv = lambda s: s.encode('latin1', 'replace')
+            items = [conv(s) for s in strings]
+            a = np.array(items, dtype=dt)
+            a_swapped = a.astype(a.dtype.newbyteorder())
+            for sub in [u'', u'a', u'ab', u'a\x00b']:
+                sub = conv(sub)
+                for start, end in [(0, None), (1, -1), (-3, 4), (5, 2),
+                                   (-20, 20)]:
+                    args = (sub, start) + (() if end is None else (end,))
+                    for name in ['count', 'find', 'rfind', 'startswith',
+                                 'endswith']:
+                        expected = [getattr(s, name)(*args) for s in items]
+                        assert_array_equal(
+                            getattr(np.char, name)(a, *args), expected)
+                assert_array_equal(np.char.replace(a, sub, conv(u'XY')),
+                                   [s.replace(sub, conv(u'XY'))
+                                    for s in items])
+                for count in [0, 1, 2]:
+                    for new in [u'', u'y']:
+                        new = conv(new)
+                        assert_array_equal(
+                            np.char.replace(a, sub, new, count),
+                            [s.replace(sub, new, count) for s in items])
+            assert_array_equal(np.char.str_len(a), [len(s) for s in items])
+            for name in ['lower', 'upper', 'strip', 'lstrip', 'rstrip']:
+                expected = np.array([getattr(s, name)() for s in items],
+                                    dtype=dt)
+                assert_array_equal(getattr(np.char, name)(a), expected)
+                assert_array_equal(getattr(np.char, name)(a_swapped),
+                                   expected)
+            assert_array_equal(np.char.strip(a, conv(u'ab')),
+                               [s.strip(conv(u'ab')) for s in items])
+
+            # broadcast arguments
+            assert_array_equal(np.char.find(a, conv(u'a'), np.arange(10) - 5),
+                               [s.find(conv(u'a'), i - 5)
+                                for i, s in enumerate(items)])
+            assert_raises(ValueError, np.char.index, a, conv(u'a'))
+            assert_raises_regex(ValueError, 'shape mismatch', np.char.find,
+                                a, conv(u'a'), np.arange(3))
+            assert_array_equal(np.char.index(a[1:3], conv(u'a')), [0, 0])
+
+    def test_sized_to_fit(self):
+        # An unsized result type sizes the result to the longest element
+        a = np.array([[u'abc', u'b'], [u'', u'bab']])
+        res = _vec_string(a, np.unicode_, 'replace', (u'b', u'xyz'))
+        assert_equal(res.dtype, np.dtype('U7'))
+        assert_array_equal(res, [[u'axyzc', u'xyz'], [u'', u'xyzaxyz']])
+        res = _vec_string(a.astype('S'), np.string_, 'replace', (b'b', b''))
+        assert_equal(res.dtype, np.dtype('S2'))
+        assert_array_equal(res, [[b'ac', b''], [b'', b'a']])
+        res = _vec_string(np.array([u'\xdf']), np.unicode_, 'upper')
+        assert_equal(res.dtype, np.dtype('U2'))
+        assert_array_equal(res, [u'SS'])
+
 
 class TestWhitespace(object):
     def setup(self):
@@ -4312,6 +4312,17 @@ class TestIO(object):
             d.tofile(f)
         assert_equal(os.path.getsize(self.filename), d.nbytes * 2)
 
+    def test_largish_file_chunked(self):
+        # reads and discontiguous writes spanning several internal chunks
+        d = np.arange(2 * 3 * 1024 ** 2, dtype=np.float64).reshape(-1, 2)
+        d[:, 0].tofile(self.filename)
+        assert_equal(os.path.getsize(self.filename), d[:, 0].nbytes)
+        assert_array_equal(d[:, 0], np.fromfile(self.filename))
+        assert_array_equal(d[:10, 0], np.fromfile(self.filename, count=10))
+        with open(self.filename, "rb") as f:
+            f.seek(8 * 100)
+            assert_array_equal(d[100:, 0], np.fromfile(f))
+
 
     def test_io_open_buffered_fromfile(self):
         # gh-6632
@@ -5296,6 +5307,29 @@ class TestDot(object):
         assert_equal(np.dot(b, a), res)
         assert_equal(np.dot(b, b), res)
 
+    def test_dot_blocked(self):
+        # large enough for the blocked matrix product of the types without
+        # BLAS, spanning several of its blocks in every dimension, and with
+        # sizes that are not multiples of them
+        rng = np.random.RandomState(1)
+        a = rng.randint(-10, 10, size=(140, 300))
+        b = rng.randint(-10, 10, size=(300, 530))
+        for t in "bhilqBHILQefdg":
+            a_t, b_t = a.astype(t), b.astype(t)
+            # the vector dot gives the same result, overflow included
+            desired = np.array([[np.dot(row, col) for col in b_t[:, ::2].T]
+                                for row in a_t[1::2]])
+            rtol = 1e-2 if t == 'e' else 1e-6
+            for ai in (a_t[1::2], np.asfortranarray(a_t)[1::2]):
+                for bi in (b_t[:, ::2], b_t[:, ::2].copy()):
+                    for res in (np.dot(ai, bi), np.matmul(ai, bi)):
+                        assert_equal(res.dtype, np.dtype(t))
+                        if t in "efdg":
+                            assert_allclose(res, desired, rtol=rtol,
+                                            atol=rtol * 1000)
+                        else:
+                            assert_equal(res, desired)
+
     def test_accelerate_framework_sgemv_fix(self):
 
         def aligned_array(shape, align, dtype, order='C'):
@@ -51,6 +51,27 @@ class TestTypes(object):
                            "error with types (%d/'%c' + %d/'%c')" %
                             (k, np.dtype(atype).char, l, np.dtype(btype).char))
 
+    def test_type_add_python_scalar(self):
+        # python scalars are converted to long, double or cdouble scalars,
+        # and the operation is done by the ufunc if that cast is not safe
+        for a, b, res in [(np.int_(3), 2, np.int_(5)),
+                          (2, np.int_(3), np.int_(5)),
+                          (np.int_(1), True, np.int_(2)),
+                          (np.double(1.5), 2, np.double(3.5)),
+                          (2, np.double(1.5), np.double(3.5)),
+                          (np.cdouble(1), 2, np.cdouble(3)),
+                          (np.cdouble(1), 2j, np.cdouble(1 + 2j)),
+                          (np.longdouble(1), 2.5, np.longdouble(3.5)),
+                          (np.intc(1), 5, np.int_(6)),
+                          (np.single(1), 5, np.double(6)),
+                          (np.double(1), 2j, np.cdouble(1 + 2j)),
+                          (np.int_(1), 2**63, np.double(2.**63)),
+                          (np.uint64(3), 2**63, np.uint64(2**63 + 3))]:
+            c = a + b
+            assert_(isinstance(c, np.generic))
+            assert_equal(c.dtype, res.dtype)
+            assert_equal(c, res)
+
     def test_type_create(self):
         for k, atype in enumerate(types):
             a = np.array([1, 2, 3], atype)
@@ -63,6 +84,24 @@ class TestTypes(object):
         for i in range(200000):
             np.add(1, 1)
 
+    def test_free_list(self):
+        # deallocated scalars of the common types are reused, which must
+        # not affect their subclasses
+        class sub(np.double):
+            pass
+
+        for atype in [np.intc, np.int_, np.longlong, np.single, np.double,
+                      np.cdouble]:
+            a = [atype(i) + atype(1) for i in range(200)]
+            del a[::2]
+            b = [sub(i) for i in range(100)]
+            c = [atype(i) * atype(2) for i in range(200)]
+            assert_equal(a, [atype(2*i + 2) for i in range(100)])
+            assert_equal([type(x) for x in b], [sub] * 100)
+            assert_equal(b, list(range(100)))
+            assert_equal([type(x) for x in c], [atype] * 200)
+            assert_equal(c, [2*i for i in range(200)])
+
 
 class TestBaseMath(object):
     def test_blocked(self):
@@ -97,6 +136,21 @@ class TestBaseMath(object):
                 np.add(2, inp2, out=out)
                 assert_almost_equal(out, exp1 + 2, err_msg=msg)
 
+    def test_floating_point_errors(self):
+        tiny = np.double(1e-300)
+        with warnings.catch_warnings():
+            warnings.simplefilter('error')
+            with np.errstate(under='ignore', divide='warn'):
+                assert_equal(tiny * tiny, 0)
+        with np.errstate(under='raise'):
+            assert_raises(FloatingPointError, operator.mul, tiny, tiny)
+
+        log = []
+        with np.errstate(under='call', call=lambda err, flag: log.append(err)):
+            tiny * tiny
+            tiny + tiny
+        assert_equal(log, ['underflow'])
+
     def test_lower_align(self):
         # check data that is not aligned to element size
         # i.e doubles are aligned to 4 bytes on i386
@@ -553,6 +553,67 @@ class TestUfunc(object):
         assert_array_almost_equal(umt.inner1d(a, b), np.sum(a*b, axis=-1),
                                   err_msg=msg)
 
+    def test_type_resolution_cache(self):
+        # the loops selected for the same operand types are cached, but
+        # for scalars the loop also depends on the value
+        a = np.ones(3, dtype=np.int8)
+        for i in range(2):
+            assert_equal(np.bitwise_and(a, np.int64(1)).dtype, np.int8)
+            assert_equal(np.bitwise_and(a, np.int64(1000)).dtype, np.int16)
+            assert_equal(np.bitwise_and(a, np.uint64(100)).dtype, np.int8)
+            assert_equal(np.bitwise_and(a, np.uint64(200)).dtype, np.int16)
+            assert_equal(np.bitwise_and(a.astype(np.uint8), -1).dtype,
+                         np.int16)
+            h = np.ones(3, dtype=np.float16)
+            assert_equal(np.hypot(h, np.float64(1e300)).dtype, np.float64)
+            assert_equal(np.hypot(h, np.float64(1)).dtype, np.float16)
+
+        # and on the casting rule and the outputs
+        b = np.ones(3, dtype=np.int16)
+        out = np.empty(3, dtype=np.bool_)
+        for i in range(2):
+            assert_raises(TypeError, np.bitwise_and, b, b, out=out)
+            np.bitwise_and(b, b, out=out, casting='unsafe')
+            assert_raises(TypeError, np.bitwise_and, b, b, out=out)
+            assert_raises(TypeError, np.hypot, a, a, casting='no')
+            assert_equal(np.hypot(a, a, casting='same_kind').dtype,
+                         np.float16)
+
+    def test_call_without_keywords(self):
+        # calls on plain arrays without keywords skip most of the general
+        # machinery, but must give the same results as calls with keywords
+        a = np.arange(1., 13.)
+        b = np.arange(2., 14.)
+        operands = [(a[:5], b[:5]), (a[::3], b[1::3]), (a[::-2], b[::2]),
+                    (a.reshape(3, 4), b.reshape(3, 4)),
+                    (a.reshape(3, 4).T, b.reshape(3, 4).T),
+                    (a.reshape(3, 4), np.array(2.)), (np.array(2.), b[:3]),
+                    (np.array(2.), np.array(3.)),
+                    (a[:3].astype(np.int8), b[:3].astype(np.int8)),
+                    (a[:3].astype('>f8'), b[:3])]
+        for x, y in operands:
+            for ufunc, args in [(np.add, (x, y)), (np.less, (x, y)),
+                                (np.divmod, (x, y)), (np.sqrt, (x,)),
+                                (np.modf, (y,))]:
+                res = ufunc(*args)
+                expected = ufunc(*args, casting='same_kind')
+                if ufunc.nout == 1:
+                    res, expected = (res,), (expected,)
+                for r, e in zip(res, expected):
+                    assert_equal(type(r), type(e))
+                    assert_equal(r.dtype, e.dtype)
+                    assert_equal(r, e)
+                    if isinstance(r, np.ndarray):
+                        assert_equal(r.flags.c_contiguous,
+                                     e.flags.c_contiguous)
+
+        # floating point errors are still reported
+        z = np.zeros(12)
+        with np.errstate(divide='raise'):
+            assert_raises(FloatingPointError, np.divide, a, z)
+        with np.errstate(divide='ignore'):
+            assert_equal(np.divide(a[:1], z[:1]), np.inf)
+
     def test_endian(self):
         msg = "big endian"
         a = np.arange(6, dtype='>i4').reshape((2, 3))
@@ -7,21 +7,44 @@
 extern "C" {
 #endif
 
-#define DOUBLE
+/*
+ * The transforms are available in single (suffix f), double (no suffix) and
+ * long double (suffix l) precision. The ``wrk`` arrays must have been
+ * initialized by the init function of the same precision and are only read
+ * by the transforms, so one can be shared by concurrent calls. ``scratch``
+ * is clobbered. The sizes of both, in values of the transform precision, are
+ * given by the functions below; lengths with a large prime factor are
+ * transformed with Bluestein's algorithm and need more room.
+ */
 
-#ifdef DOUBLE
-#define Treal double
-#else
-#define Treal float
-#endif
+extern NPY_VISIBILITY_HIDDEN npy_intp npy_cfft_worksize(int N);
+extern NPY_VISIBILITY_HIDDEN npy_intp npy_rfft_worksize(int N);
+extern NPY_VISIBILITY_HIDDEN npy_intp npy_cfft_scratchsize(int N);
+extern NPY_VISIBILITY_HIDDEN npy_intp npy_rfft_scratchsize(int N);
+
+extern NPY_VISIBILITY_HIDDEN void npy_cfftff(int N, npy_float data[], const npy_float wrk[], npy_float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftbf(int N, npy_float data[], const npy_float wrk[], npy_float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftif(int N, npy_float wrk[]);
+
+extern NPY_VISIBILITY_HIDDEN void npy_rfftff(int N, npy_float data[], const npy_float wrk[], npy_float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftbf(int N, npy_float data[], const npy_float wrk[], npy_float scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftif(int N, npy_float wrk[]);
+
+extern NPY_VISIBILITY_HIDDEN void npy_cfftf(int N, npy_double data[], const npy_double wrk[], npy_double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftb(int N, npy_double data[], const npy_double wrk[], npy_double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cffti(int N, npy_double wrk[]);
+
+extern NPY_VISIBILITY_HIDDEN void npy_rfftf(int N, npy_double data[], const npy_double wrk[], npy_double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftb(int N, npy_double data[], const npy_double wrk[], npy_double scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rffti(int N, npy_double wrk[]);
 
-extern NPY_VISIBILITY_HIDDEN void npy_cfftf(int N, Treal data[], const Treal wrk[]);
-extern NPY_VISIBILITY_HIDDEN void npy_cfftb(int N, Treal data[], const Treal wrk[]);
-extern NPY_VISIBILITY_HIDDEN void npy_cffti(int N, Treal wrk[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftfl(int N, npy_longdouble data[], const npy_longdouble wrk[], npy_longdouble scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftbl(int N, npy_longdouble data[], const npy_longdouble wrk[], npy_longdouble scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_cfftil(int N, npy_longdouble wrk[]);
 
-extern NPY_VISIBILITY_HIDDEN void npy_rfftf(int N, Treal data[], const Treal wrk[]);
-extern NPY_VISIBILITY_HIDDEN void npy_rfftb(int N, Treal data[], const Treal wrk[]);
-extern NPY_VISIBILITY_HIDDEN void npy_rffti(int N, Treal wrk[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftfl(int N, npy_longdouble data[], const npy_longdouble wrk[], npy_longdouble scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftbl(int N, npy_longdouble data[], const npy_longdouble wrk[], npy_longdouble scratch[]);
+extern NPY_VISIBILITY_HIDDEN void npy_rfftil(int N, npy_longdouble wrk[]);
 
 #ifdef __cplusplus
 }
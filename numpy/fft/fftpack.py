@@ -35,60 +35,121 @@ from __future__ import division, absolute_import, print_function
 __all__ = ['fft', 'ifft', 'rfft', 'irfft', 'hfft', 'ihfft', 'rfftn',
            'irfftn', 'rfft2', 'irfft2', 'fft2', 'ifft2', 'fftn', 'ifftn']
 
-from numpy.core import (array, asarray, zeros, swapaxes, shape, conjugate,
-                        take, sqrt)
+from numpy.core import (array, asarray, zeros, empty, swapaxes, shape,
+                        conjugate, take, sqrt)
+from numpy.core.multiarray import normalize_axis_index
+from numpy.core._parallel import thread_count, run_blocks
 from . import fftpack_lite as fftpack
 from .helper import _FFTCache
 
 _fft_cache = _FFTCache(max_size_in_mb=100, max_item_count=32)
 _real_fft_cache = _FFTCache(max_size_in_mb=100, max_item_count=32)
 
+# Single and extended precision inputs are transformed in their own precision,
+# everything else in double precision.
+_fft_precision = {'f': 'f', 'F': 'f', 'g': 'g', 'G': 'g'}
 
-def _raw_fft(a, n=None, axis=-1, init_function=fftpack.cffti,
-             work_function=fftpack.cfftf, fft_cache=_fft_cache):
+# Batches of 1-d transforms are split into blocks of rows transformed by up to
+# this many threads, each with at least _fft_thread_points points. This is off
+# unless the NPY_FFT_THREADS environment variable is set.
+_fft_threads = thread_count('NPY_FFT_THREADS')
+_fft_thread_points = 1 << 16
+
+
+def _fft_input(a, real=False, copy=True):
+    """
+    Convert `a` to an array of the real or complex type it is transformed in.
+    """
     a = asarray(a)
+    precision = _fft_precision.get(a.dtype.char, 'd')
+    return array(a, copy=copy, dtype=precision if real else precision.upper())
 
-    if n is None:
-        n = a.shape[axis]
 
+def _twiddle_factors(n, precision, init_function, fft_cache):
+    """
+    Return the read-only work array for transforms of length `n`.
+
+    The C code never writes to the work arrays, so a cached one can be used
+    by any number of threads at the same time.
+    """
     if n < 1:
         raise ValueError("Invalid number of FFT data points (%d) specified."
                          % n)
 
-    # We have to ensure that only a single thread can access a wsave array
-    # at any given time. Thus we remove it from the cache and insert it
-    # again after it has been used. Multiple threads might create multiple
-    # copies of the wsave array. This is intentional and a limitation of
-    # the current C code.
-    wsave = fft_cache.pop_twiddle_factors(n)
+    wsave = fft_cache.get_twiddle_factors((n, precision))
     if wsave is None:
-        wsave = init_function(n)
-
-    if a.shape[axis] != n:
-        s = list(a.shape)
-        if s[axis] > n:
-            index = [slice(None)]*len(s)
-            index[axis] = slice(0, n)
-            a = a[tuple(index)]
-        else:
-            index = [slice(None)]*len(s)
-            index[axis] = slice(0, s[axis])
-            s[axis] = n
-            z = zeros(s, a.dtype.char)
-            z[tuple(index)] = a
-            a = z
+        wsave = init_function(n, precision)
+        wsave.flags.writeable = False
+        fft_cache.put_twiddle_factors((n, precision), wsave)
+    return wsave
+
+
+def _fft_resize(a, n, axis):
+    """
+    Crop or zero-pad `a` to length `n` along `axis`.
+    """
+    s = list(a.shape)
+    if s[axis] > n:
+        index = [slice(None)]*len(s)
+        index[axis] = slice(0, n)
+        a = a[tuple(index)]
+    elif s[axis] < n:
+        index = [slice(None)]*len(s)
+        index[axis] = slice(0, s[axis])
+        s[axis] = n
+        z = zeros(s, a.dtype.char)
+        z[tuple(index)] = a
+        a = z
+    return a
+
+
+def _parallel_rows(work_function, a, wsave):
+    """
+    Apply `work_function` to each row along the last axis of `a`.
 
+    Large batches are split into blocks of rows which are transformed in
+    separate threads, each writing into its part of the result; the C code
+    releases the GIL and only reads `wsave`.
+    """
+    n = a.shape[-1]
+    nrows = a.size // n if n else 0
+    nthreads = min(_fft_threads, nrows, a.size // _fft_thread_points)
+    if nthreads <= 1:
+        return work_function(a, wsave)
+
+    # wsave has the real type of the precision the rows are transformed in
+    if work_function is fftpack.rfftf:
+        m, dtype = n//2 + 1, wsave.dtype.char.upper()
+    elif work_function is fftpack.rfftb:
+        m, dtype = n, wsave.dtype.char
+    else:
+        m, dtype = n, wsave.dtype.char.upper()
+    rows = a.reshape(-1, n)
+    r = empty((nrows, m), dtype)
+
+    def transform(start, stop):
+        work_function(rows[start:stop], wsave, r[start:stop])
+
+    run_blocks(transform, nrows, nthreads)
+    return r.reshape(a.shape[:-1] + (m,))
+
+
+def _raw_fft(a, n=None, axis=-1, init_function=fftpack.cffti,
+             work_function=fftpack.cfftf, fft_cache=_fft_cache):
+    a = asarray(a)
+
+    if n is None:
+        n = a.shape[axis]
+
+    precision = _fft_precision.get(a.dtype.char, 'd')
+    wsave = _twiddle_factors(n, precision, init_function, fft_cache)
+
+    a = _fft_resize(a, n, axis)
     if axis != -1:
         a = swapaxes(a, axis, -1)
-    r = work_function(a, wsave)
+    r = _parallel_rows(work_function, a, wsave)
     if axis != -1:
         r = swapaxes(r, axis, -1)
-
-    # As soon as we put wsave back into the cache, another thread could pick it
-    # up and start using it, so we must not do this until after we're
-    # completely done using it ourselves.
-    fft_cache.put_twiddle_factors(n, wsave)
-
     return r
 
 
@@ -186,7 +247,7 @@ def fft(a, n=None, axis=-1, norm=None):
 
     """
 
-    a = asarray(a).astype(complex, copy=False)
+    a = _fft_input(a, copy=False)
     if n is None:
         n = a.shape[axis]
     output = _raw_fft(a, n, axis, fftpack.cffti, fftpack.cfftf, _fft_cache)
@@ -280,7 +341,7 @@ def ifft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = _fft_input(a)
     if n is None:
         n = a.shape[axis]
     unitary = _unitary(norm)
@@ -367,7 +428,7 @@ def rfft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
+    a = _fft_input(a, real=True)
     output = _raw_fft(a, n, axis, fftpack.rffti, fftpack.rfftf,
                       _real_fft_cache)
     if _unitary(norm):
@@ -458,7 +519,7 @@ def irfft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = _fft_input(a)
     if n is None:
         n = (a.shape[axis] - 1) * 2
     unitary = _unitary(norm)
@@ -542,7 +603,7 @@ def hfft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = _fft_input(a)
     if n is None:
         n = (a.shape[axis] - 1) * 2
     unitary = _unitary(norm)
@@ -602,7 +663,7 @@ def ihfft(a, n=None, axis=-1, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
+    a = _fft_input(a, real=True)
     if n is None:
         n = a.shape[axis]
     unitary = _unitary(norm)
@@ -632,10 +693,37 @@ def _cook_nd_args(a, s=None, axes=None, invreal=0):
 def _raw_fftnd(a, s=None, axes=None, function=fft, norm=None):
     a = asarray(a)
     s, axes = _cook_nd_args(a, s, axes)
-    itl = list(range(len(axes)))
-    itl.reverse()
-    for ii in itl:
-        a = function(a, n=s[ii], axis=axes[ii], norm=norm)
+    axes = [normalize_axis_index(ax, a.ndim) for ax in axes]
+    if len(set(axes)) != len(axes):
+        # An axis transformed more than once may be cropped or padded in
+        # between, so do one axis at a time.
+        itl = list(range(len(axes)))
+        itl.reverse()
+        for ii in itl:
+            a = function(a, n=s[ii], axis=axes[ii], norm=norm)
+        return a
+
+    # Transform all axes in a single pass over one copy of the data, the last
+    # axis first.
+    a = _fft_input(a, copy=False)
+    precision = _fft_precision.get(a.dtype.char, 'd')
+    wsaves = []
+    for n, axis in zip(s[::-1], axes[::-1]):
+        wsaves.append(_twiddle_factors(n, precision, fftpack.cffti,
+                                       _fft_cache))
+        a = _fft_resize(a, n, axis)
+    if function is fft:
+        a = fftpack.cfftnf(a, axes[::-1], wsaves)
+    else:
+        a = fftpack.cfftnb(a, axes[::-1], wsaves)
+
+    size = 1
+    for n in s:
+        size *= n
+    if _unitary(norm):
+        a *= 1 / sqrt(size)
+    elif function is not fft:
+        a *= 1 / size
     return a
 
 
@@ -1094,11 +1182,11 @@ def rfftn(a, s=None, axes=None, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
+    a = _fft_input(a, real=True)
     s, axes = _cook_nd_args(a, s, axes)
     a = rfft(a, s[-1], axes[-1], norm)
-    for ii in range(len(axes)-1):
-        a = fft(a, s[ii], axes[ii], norm)
+    if len(axes) > 1:
+        a = _raw_fftnd(a, s[-2::-1], axes[-2::-1], fft, norm)
     return a
 
 
@@ -1225,10 +1313,10 @@ def irfftn(a, s=None, axes=None, norm=None):
 
     """
     # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = _fft_input(a)
     s, axes = _cook_nd_args(a, s, axes, invreal=1)
-    for ii in range(len(axes)-1):
-        a = ifft(a, s[ii], axes[ii], norm)
+    if len(axes) > 1:
+        a = _raw_fftnd(a, s[-2::-1], axes[-2::-1], ifft, norm)
     a = irfft(a, s[-1], axes[-1], norm)
     return a
 
@@ -302,6 +302,32 @@ class _FFTCache(object):
                 self._dict[n] = all_values
             return value
 
+    def get_twiddle_factors(self, n):
+        """
+        Get twiddle factors for an FFT of length n from the cache, leaving
+        them in the cache.
+
+        Will return None if the requested twiddle factors are not available in
+        the cache.
+
+        Parameters
+        ----------
+        n : int
+            Data length for the FFT.
+
+        Returns
+        -------
+        out : ndarray or None
+            The retrieved twiddle factors if available, else None.
+        """
+        with self._lock:
+            if n not in self._dict or not self._dict[n]:
+                return None
+            # Pop + add to move it to the end for LRU behavior.
+            all_values = self._dict.pop(n)
+            self._dict[n] = all_values
+            return all_values[-1]
+
     def _prune_cache(self):
         # Always keep at least one item.
         while len(self._dict) > 1 and (
@@ -118,6 +118,14 @@ The inverse DFT is defined as
 It differs from the forward transform by the sign of the exponential
 argument and the default normalization by :math:`1/n`.
 
+Transforms of single precision (``float32`` or ``complex64``) and extended
+precision (``longdouble`` or ``clongdouble``) inputs are computed and returned
+in that precision. All other inputs are converted to double precision first.
+
+The 1-d transforms of a batch of many rows, such as `fft` of a large 2-d array,
+can be split between several threads. This is opt-in: the number of threads is
+set with the ``NPY_FFT_THREADS`` environment variable and defaults to one.
+
 Normalization
 -------------
 The default normalization has the direct transforms unscaled and the inverse
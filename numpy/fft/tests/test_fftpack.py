@@ -4,6 +4,7 @@ import numpy as np
 from numpy.random import random
 from numpy.testing import (
         assert_array_almost_equal, assert_array_equal, assert_raises,
+        assert_equal, assert_allclose, assert_,
         )
 import threading
 import sys
@@ -70,6 +71,43 @@ class TestFFT1D(object):
         assert_array_almost_equal(np.fft.ifftn(x) * np.sqrt(30 * 20 * 10),
                                   np.fft.ifftn(x, norm="ortho"))
 
+    def test_fft_lengths(self):
+        # radix 8 passes, and lengths with a large prime factor which are
+        # transformed with Bluestein's algorithm
+        for n in [8, 64, 512, 101, 206, 3*211, 4*257]:
+            x = random(n) + 1j*random(n)
+            expected = fft1(x)
+            assert_array_almost_equal(np.fft.fft(x), expected)
+            assert_array_almost_equal(np.fft.ifft(np.fft.fft(x)), x)
+            assert_array_almost_equal(np.fft.rfft(x.real),
+                                      fft1(x.real)[:n//2 + 1])
+            assert_array_almost_equal(np.fft.irfft(np.fft.rfft(x.real), n),
+                                      x.real)
+            assert_allclose(np.fft.fft(x.astype(np.complex64)), expected,
+                            atol=1e-5*abs(expected).max())
+        x = random((101, 6)) + 1j*random((101, 6))
+        assert_array_almost_equal(np.fft.fftn(x),
+                                  np.fft.fft(np.fft.fft(x, axis=0), axis=1))
+
+    def test_fftn_axes(self):
+        x = random((6, 5, 4)) + 1j*random((6, 5, 4))
+        for axes, s in [((0, 2), None), ((2, 0), (8, 3)), ((-1, 1), (7, 5)),
+                        ((1,), (2,))]:
+            expected = x
+            for ii in reversed(range(len(axes))):
+                n = None if s is None else s[ii]
+                expected = np.fft.fft(expected, n=n, axis=axes[ii])
+            assert_array_almost_equal(np.fft.fftn(x, s, axes), expected)
+            for norm in [None, "ortho"]:
+                y = np.fft.fftn(x, s, axes, norm=norm)
+                back = np.fft.ifftn(y, s, axes, norm=norm)
+                if s is None:
+                    assert_array_almost_equal(back, x)
+        # repeated axes transform the same axis twice
+        assert_array_almost_equal(np.fft.fftn(x, axes=(0, 0)),
+                                  np.fft.fft(np.fft.fft(x, axis=0), axis=0))
+        assert_raises(ValueError, np.fft.fftn, x, (0, 2), (0, 1))
+
     def test_rfft(self):
         x = random(30)
         for n in [x.size, 2*x.size]:
@@ -146,6 +184,65 @@ class TestFFT1D(object):
                     assert_array_almost_equal(x_norm,
                                               np.linalg.norm(tmp))
 
+
+class TestFFTPrecision(object):
+
+    def test_single(self):
+        x = random(30) + 1j*random(30)
+        for xs in [x.astype(np.complex64), x.real.astype(np.float32)]:
+            y = np.fft.fft(xs)
+            assert_equal(y.dtype, np.complex64)
+            assert_allclose(y, np.fft.fft(xs.astype(x.dtype)), rtol=1e-5)
+            assert_equal(np.fft.ifft(y).dtype, np.complex64)
+            assert_allclose(np.fft.ifft(y), xs, rtol=1e-5, atol=1e-6)
+
+        xr = x.real.astype(np.float32)
+        y = np.fft.rfft(xr)
+        assert_equal(y.dtype, np.complex64)
+        assert_allclose(y, np.fft.rfft(x.real), rtol=1e-5, atol=1e-5)
+        assert_equal(np.fft.irfft(y).dtype, np.float32)
+        assert_allclose(np.fft.irfft(y), xr, rtol=1e-5, atol=1e-6)
+        assert_equal(np.fft.rfftn(xr.reshape(5, 6)).dtype, np.complex64)
+        assert_equal(np.fft.hfft(y).dtype, np.float32)
+        y = np.fft.fftn(x.astype(np.complex64).reshape(5, 6))
+        assert_equal(y.dtype, np.complex64)
+        assert_allclose(y, np.fft.fftn(x.reshape(5, 6)), rtol=1e-5, atol=1e-5)
+
+    def test_single_many_factors(self):
+        # the 14 factors of 3**14 overflowed the float32 plans
+        n = 3**14
+        x = np.ones(n, np.complex64)
+        y = np.fft.fft(x)
+        assert_allclose(y[0], n, rtol=1e-5)
+        assert_(abs(y[1:]).max() < 1e-3 * n)
+        y = np.fft.rfft(x.real)
+        assert_allclose(y[0], n, rtol=1e-5)
+        assert_(abs(y[1:]).max() < 1e-3 * n)
+
+    def test_longdouble(self):
+        x = random(30) + 1j*random(30)
+        xl = x.astype(np.clongdouble)
+        y = np.fft.fft(xl)
+        assert_equal(y.dtype, np.clongdouble)
+        assert_array_almost_equal(y, np.fft.fft(x))
+        assert_equal(np.fft.rfft(x.real.astype(np.longdouble)).dtype,
+                     np.clongdouble)
+        assert_equal(np.fft.irfft(y).dtype, np.longdouble)
+
+        # the long double transform is at least as accurate as the double one
+        n = 64
+        xl = np.arange(n, dtype=np.longdouble) / n
+        err_l = abs(np.fft.ifft(np.fft.fft(xl)) - xl).max()
+        err_d = abs(np.fft.ifft(np.fft.fft(xl.astype(np.float64))) - xl).max()
+        assert_(err_l <= err_d)
+
+    def test_other_types_use_double(self):
+        for dt in [np.int32, np.int64, np.float16, bool]:
+            x = np.arange(8).astype(dt)
+            assert_equal(np.fft.fft(x).dtype, np.complex128)
+            assert_equal(np.fft.rfft(x).dtype, np.complex128)
+
+
 class TestFFTThreadSafe(object):
     threads = 16
     input_shape = (800, 200)
@@ -183,3 +280,50 @@ class TestFFTThreadSafe(object):
     def test_irfft(self):
         a = np.ones(self.input_shape) * 1+0j
         self._test_mtsame(np.fft.irfft, a)
+
+    def test_fftn(self):
+        a = np.ones(self.input_shape) * 1+0j
+        self._test_mtsame(np.fft.fftn, a)
+
+    def test_parallel_rows(self):
+        # batches split between threads give the same result as one thread
+        fftpack = np.fft.fftpack
+        x = random((37, 3, 24)) + 1j*random((37, 3, 24))
+        funcs = [(np.fft.fft, x), (np.fft.ifft, x), (np.fft.rfft, x.real),
+                 (np.fft.irfft, x), (np.fft.fft, x.astype(np.complex64))]
+        expected = [[f(a, axis=axis) for axis in range(3)] for f, a in funcs]
+        old = fftpack._fft_threads, fftpack._fft_thread_points
+        try:
+            fftpack._fft_threads, fftpack._fft_thread_points = 4, 1
+            for (f, a), exp in zip(funcs, expected):
+                for axis in range(3):
+                    r = f(a, axis=axis)
+                    assert_equal(r.dtype, exp[axis].dtype)
+                    assert_array_equal(r, exp[axis])
+        finally:
+            fftpack._fft_threads, fftpack._fft_thread_points = old
+
+    def test_work_function_out(self):
+        # the row transforms can write into a given C contiguous array
+        lite = np.fft.fftpack_lite
+        x = random((3, 8)) + 1j*random((3, 8))
+        for work, init, a, shape, dtype in [
+                (lite.cfftf, lite.cffti, x, (3, 8), complex),
+                (lite.cfftb, lite.cffti, x, (3, 8), complex),
+                (lite.rfftf, lite.rffti, x.real, (3, 5), complex),
+                (lite.rfftb, lite.rffti, x, (3, 8), float)]:
+            wsave = init(8)
+            out = np.empty(shape, dtype)
+            assert_(work(a, wsave, out) is out)
+            assert_array_equal(out, work(a, wsave))
+            assert_raises(ValueError, work, a, wsave, out[:2])
+            assert_raises(ValueError, work, a, wsave, np.empty(shape, np.int8))
+
+    def test_shared_work_array(self):
+        # The cached work array is read-only and reused, not copied per call
+        cache = np.fft.fftpack._fft_cache
+        np.fft.fft(np.ones(37))
+        wsave = cache.get_twiddle_factors((37, 'd'))
+        assert_(not wsave.flags.writeable)
+        self._test_mtsame(np.fft.fft, np.ones((16, 37)))
+        assert_(cache.get_twiddle_factors((37, 'd')) is wsave)
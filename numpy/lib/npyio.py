@@ -44,7 +44,8 @@ def loads(*args, **kwargs):
 __all__ = [
     'savetxt', 'loadtxt', 'genfromtxt', 'ndfromtxt', 'mafromtxt',
     'recfromtxt', 'recfromcsv', 'load', 'loads', 'save', 'savez',
-    'savez_compressed', 'packbits', 'unpackbits', 'fromregex', 'DataSource'
+    'savez_compressed', 'packbits', 'unpackbits', 'fromregex',
+    'fromfile_chunks', 'DataSource'
     ]
 
 
@@ -1492,6 +1493,84 @@ def fromregex(file, regexp, dtype, encoding=None):
             file.close()
 
 
+def fromfile_chunks(file, dtype=float, chunksize=65536, count=-1, offset=0):
+    """
+    Iterate over a binary file, yielding arrays of at most `chunksize` records.
+
+    This behaves like reading the file with `fromfile` and splitting the
+    result into consecutive pieces, but never holds more than one chunk in
+    memory, so that files much larger than the available memory can be
+    processed record by record.
+
+    .. versionadded:: 1.15.0
+
+    Parameters
+    ----------
+    file : file, str or pathlib.Path
+        Open file object or filename. File objects must be opened in binary
+        mode and support ``fileno``, as for `fromfile`.
+    dtype : data-type, optional
+        Data type of the records in the file.
+    chunksize : int, optional
+        Maximum number of records in each yielded array.
+    count : int, optional
+        Total number of records to read. ``-1`` means read until the end of
+        the file.
+    offset : int, optional
+        Number of bytes to skip from the current position of the file (or
+        from the start, for a filename) before the first record.
+
+    Yields
+    ------
+    chunk : ndarray
+        One-dimensional array of `dtype`. Every chunk except possibly the
+        last holds exactly `chunksize` records.
+
+    See Also
+    --------
+    fromfile, memmap
+
+    Examples
+    --------
+    >>> np.arange(10, dtype=np.int16).tofile('test.dat')
+    >>> for chunk in np.fromfile_chunks('test.dat', np.int16, chunksize=4):
+    ...     print(chunk)
+    [0 1 2 3]
+    [4 5 6 7]
+    [8 9]
+
+    """
+    dtype = np.dtype(dtype)
+    chunksize = opindex(chunksize)
+    if chunksize <= 0:
+        raise ValueError("chunksize must be positive")
+
+    own_fh = False
+    if is_pathlib_path(file):
+        file = str(file)
+    if isinstance(file, basestring):
+        file = open(file, 'rb')
+        own_fh = True
+
+    try:
+        if offset:
+            file.seek(offset, 1)
+        remaining = count
+        while remaining != 0:
+            n = chunksize if remaining < 0 else min(chunksize, remaining)
+            chunk = np.fromfile(file, dtype=dtype, count=n)
+            if chunk.size == 0:
+                break
+            if remaining > 0:
+                remaining -= chunk.size
+            yield chunk
+            if chunk.size < n:
+                break
+    finally:
+        if own_fh:
+            file.close()
+
+
 #####--------------------------------------------------------------------------
 #---- --- ASCII functions ---
 #####--------------------------------------------------------------------------
@@ -1126,6 +1126,53 @@ class Testfromregex(object):
         x = np.fromregex(c, regexp, dt)
         assert_array_equal(x, a)
 
+
+class TestFromfileChunks(object):
+    def test_chunks(self):
+        a = np.arange(10, dtype=np.int16)
+        with temppath() as path:
+            a.tofile(path)
+            chunks = list(np.fromfile_chunks(path, np.int16, chunksize=4))
+        assert_equal([len(c) for c in chunks], [4, 4, 2])
+        assert_(all(c.dtype == np.int16 for c in chunks))
+        assert_array_equal(np.concatenate(chunks), a)
+
+    def test_count_and_offset(self):
+        dt = np.dtype([('x', '<i4'), ('y', '<f8')])
+        a = np.zeros(7, dtype=dt)
+        a['x'] = np.arange(7)
+        with temppath() as path:
+            a.tofile(path)
+            chunks = list(np.fromfile_chunks(path, dt, chunksize=2,
+                                             count=3, offset=dt.itemsize))
+            assert_array_equal(np.concatenate(chunks), a[1:4])
+
+            # file objects are read from their current position, and left
+            # positioned after the last record read
+            with open(path, 'rb') as f:
+                f.seek(2 * dt.itemsize)
+                chunks = list(np.fromfile_chunks(f, dt, chunksize=3,
+                                                 count=4))
+                assert_equal(f.tell(), 6 * dt.itemsize)
+            assert_array_equal(np.concatenate(chunks), a[2:6])
+
+    def test_empty_and_errors(self):
+        with temppath() as path:
+            open(path, 'wb').close()
+            assert_equal(list(np.fromfile_chunks(path)), [])
+            assert_raises(ValueError, list,
+                          np.fromfile_chunks(path, chunksize=0))
+
+    def test_pathlib(self):
+        if Path is None:
+            pytest.skip("pathlib not available")
+        a = np.arange(5.)
+        with temppath(suffix='.dat') as path:
+            a.tofile(path)
+            chunks = list(np.fromfile_chunks(Path(path), chunksize=5))
+        assert_equal(len(chunks), 1)
+        assert_array_equal(chunks[0], a)
+
 #####--------------------------------------------------------------------------
 
 
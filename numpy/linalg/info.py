@@ -20,7 +20,15 @@ Eigenvalues and decompositions:
 - eigvalsh        Eigenvalues of a Hermitian matrix
 - qr              QR decomposition of a matrix
 - svd             Singular value decomposition of a matrix
+- randomized_svd  Largest singular values and vectors of a matrix
 - cholesky        Cholesky decomposition of a matrix
+- lu_factor       LU decomposition of a matrix, for lu_solve
+- cho_factor      Cholesky decomposition of a matrix, for cho_solve
+
+Solving with a factorization:
+
+- lu_solve        Solve a linear system given its LU decomposition
+- cho_solve       Solve a linear system given its Cholesky decomposition
 
 Tensor operations:
 
@@ -31,6 +39,11 @@ Exceptions:
 
 - LinAlgError     Indicates a failed linear algebra operation
 
+Large stacks of small matrices passed to solve, inv, det, slogdet, eigh,
+eigvalsh and svd can be split between several threads. This is opt-in: the
+number of threads is set with the ``NPY_LINALG_THREADS`` environment variable
+and defaults to one.
+
 """
 from __future__ import division, absolute_import, print_function
 
@@ -6837,7 +6837,7 @@ L60:
     return ret_val;
 } /* ddot_ */
 
-/* Subroutine */ int dgemm_(char *transa, char *transb, integer *m, integer *
+/* Subroutine */ int dgemm_ref_(char *transa, char *transb, integer *m, integer *
 	n, integer *k, doublereal *alpha, doublereal *a, integer *lda,
 	doublereal *b, integer *ldb, doublereal *beta, doublereal *c__,
 	integer *ldc)
@@ -7201,7 +7201,7 @@ L60:
 
 /*     End of DGEMM . */
 
-} /* dgemm_ */
+} /* dgemm_ref_ */
 
 /* Subroutine */ int dgemv_(char *trans, integer *m, integer *n, doublereal *
 	alpha, doublereal *a, integer *lda, doublereal *x, integer *incx,
@@ -8939,7 +8939,7 @@ L40:
 
 } /* dsyr2k_ */
 
-/* Subroutine */ int dsyrk_(char *uplo, char *trans, integer *n, integer *k,
+/* Subroutine */ int dsyrk_ref_(char *uplo, char *trans, integer *n, integer *k,
 	doublereal *alpha, doublereal *a, integer *lda, doublereal *beta,
 	doublereal *c__, integer *ldc)
 {
@@ -9286,7 +9286,7 @@ L40:
 
 /*     End of DSYRK . */
 
-} /* dsyrk_ */
+} /* dsyrk_ref_ */
 
 /* Subroutine */ int dtrmm_(char *side, char *uplo, char *transa, char *diag,
 	integer *m, integer *n, doublereal *alpha, doublereal *a, integer *
@@ -10044,7 +10044,7 @@ L40:
 
 } /* dtrmv_ */
 
-/* Subroutine */ int dtrsm_(char *side, char *uplo, char *transa, char *diag,
+/* Subroutine */ int dtrsm_ref_(char *side, char *uplo, char *transa, char *diag,
 	integer *m, integer *n, doublereal *alpha, doublereal *a, integer *
 	lda, doublereal *b, integer *ldb)
 {
@@ -10509,7 +10509,7 @@ L40:
 
 /*     End of DTRSM . */
 
-} /* dtrsm_ */
+} /* dtrsm_ref_ */
 
 doublereal dzasum_(integer *n, doublecomplex *zx, integer *incx)
 {
@@ -11442,7 +11442,7 @@ L60:
     return ret_val;
 } /* sdot_ */
 
-/* Subroutine */ int sgemm_(char *transa, char *transb, integer *m, integer *
+/* Subroutine */ int sgemm_ref_(char *transa, char *transb, integer *m, integer *
 	n, integer *k, real *alpha, real *a, integer *lda, real *b, integer *
 	ldb, real *beta, real *c__, integer *ldc)
 {
@@ -11805,7 +11805,7 @@ L60:
 
 /*     End of SGEMM . */
 
-} /* sgemm_ */
+} /* sgemm_ref_ */
 
 /* Subroutine */ int sgemv_(char *trans, integer *m, integer *n, real *alpha,
 	real *a, integer *lda, real *x, integer *incx, real *beta, real *y,
@@ -13542,7 +13542,7 @@ L40:
 
 } /* ssyr2k_ */
 
-/* Subroutine */ int ssyrk_(char *uplo, char *trans, integer *n, integer *k,
+/* Subroutine */ int ssyrk_ref_(char *uplo, char *trans, integer *n, integer *k,
 	real *alpha, real *a, integer *lda, real *beta, real *c__, integer *
 	ldc)
 {
@@ -13889,7 +13889,7 @@ L40:
 
 /*     End of SSYRK . */
 
-} /* ssyrk_ */
+} /* ssyrk_ref_ */
 
 /* Subroutine */ int strmm_(char *side, char *uplo, char *transa, char *diag,
 	integer *m, integer *n, real *alpha, real *a, integer *lda, real *b,
@@ -14647,7 +14647,7 @@ L40:
 
 } /* strmv_ */
 
-/* Subroutine */ int strsm_(char *side, char *uplo, char *transa, char *diag,
+/* Subroutine */ int strsm_ref_(char *side, char *uplo, char *transa, char *diag,
 	integer *m, integer *n, real *alpha, real *a, integer *lda, real *b,
 	integer *ldb)
 {
@@ -15112,7 +15112,7 @@ L40:
 
 /*     End of STRSM . */
 
-} /* strsm_ */
+} /* strsm_ref_ */
 
 /* Subroutine */ int zaxpy_(integer *n, doublecomplex *za, doublecomplex *zx,
 	integer *incx, doublecomplex *zy, integer *incy)
@@ -6,7 +6,8 @@ This module is a lite version of the linalg.py module in SciPy which
 contains high-level Python interface to the LAPACK library.  The lite
 version only accesses the following LAPACK functions: dgesv, zgesv,
 dgeev, zgeev, dgesdd, zgesdd, dgelsd, zgelsd, dsyevd, zheevd, dgetrf,
-zgetrf, dpotrf, zpotrf, dgeqrf, zgeqrf, zungqr, dorgqr.
+zgetrf, dgetrs, zgetrs, dpotrf, zpotrf, dpotrs, zpotrs, dgeqrf, zgeqrf,
+zungqr, dorgqr, dsytrd, zhetrd, dormtr, zunmtr, dsterf.
 """
 from __future__ import division, absolute_import, print_function
 
@@ -14,7 +15,8 @@ from __future__ import division, absolute_import, print_function
 __all__ = ['matrix_power', 'solve', 'tensorsolve', 'tensorinv', 'inv',
            'cholesky', 'eigvals', 'eigvalsh', 'pinv', 'slogdet', 'det',
            'svd', 'eig', 'eigh', 'lstsq', 'norm', 'qr', 'cond', 'matrix_rank',
-           'LinAlgError', 'multi_dot']
+           'LinAlgError', 'multi_dot', 'lu_factor', 'lu_solve', 'cho_factor',
+           'cho_solve', 'randomized_svd']
 
 import operator
 import warnings
@@ -28,6 +30,7 @@ from numpy.core import (
     swapaxes, divide, count_nonzero, isnan
 )
 from numpy.core.multiarray import normalize_axis_index
+from numpy.core._parallel import thread_count, run_blocks
 from numpy.lib.twodim_base import triu, eye
 from numpy.linalg import lapack_lite, _umath_linalg
 
@@ -105,6 +108,65 @@ def get_linalg_error_extobj(callback):
     extobj[2] = callback
     return extobj
 
+# Stacks of matrices of at most _linalg_thread_max_dim rows and columns are
+# split along their first axis between up to this many threads, each with
+# work for at least _linalg_thread_work multiply-adds. This is off unless the
+# NPY_LINALG_THREADS environment variable is set, as the gufuncs may call a
+# multithreaded BLAS; larger matrices are always left to the BLAS.
+_linalg_threads = thread_count('NPY_LINALG_THREADS')
+_linalg_thread_max_dim = 64
+_linalg_thread_work = 1 << 20
+
+def _stacked_gufunc(gufunc, *operands, **kwargs):
+    """
+    Call `gufunc` on `operands`, splitting large stacks of small matrices
+    into blocks computed in separate threads.
+
+    The gufunc loops release the GIL, so the blocks only share the read-only
+    inputs and write into their own part of the outputs. Each block also
+    checks its floating point errors with the error object of the calling
+    thread.
+    """
+    cores = [len(c.split(',')) if c else 0 for c in
+             gufunc.signature.split('->')[0][1:-1].split('),(')]
+    outers = [op.shape[:op.ndim - core] for op, core in zip(operands, cores)]
+    ndim = max(len(outer) for outer in outers)
+    a = operands[0]
+    m, n = a.shape[-2:]
+    if ndim == 0 or max(m, n) > _linalg_thread_max_dim:
+        return gufunc(*operands, **kwargs)
+
+    # the first axis of the stack; operands broadcast against it unsplit
+    length = max(outer[0] for outer in outers if len(outer) == ndim)
+    split = [len(outer) == ndim and outer[0] != 1 for outer in outers]
+    if any(s and outer[0] != length for s, outer in zip(split, outers)):
+        return gufunc(*operands, **kwargs)
+    work = (a.size // max(m*n, 1)) * m * n * min(m, n)
+    nthreads = min(_linalg_threads, length - 1, work // _linalg_thread_work)
+    if nthreads <= 1:
+        return gufunc(*operands, **kwargs)
+
+    def block(start, stop):
+        return [op[start:stop] if s else op for op, s in zip(operands, split)]
+
+    # the result for the first matrix gives the types and shapes of the
+    # outputs, into which blocks of the remaining ones are computed
+    kwargs.setdefault('extobj', geterrobj())
+    first = gufunc(*block(0, 1), **kwargs)
+    single = not isinstance(first, tuple)
+    if single:
+        first = (first,)
+    outs = tuple(empty((length,) + r.shape[1:], r.dtype) for r in first)
+    for out, r in zip(outs, first):
+        out[:1] = r
+
+    def compute(start, stop):
+        gufunc(*block(start + 1, stop + 1),
+               out=tuple(out[start + 1:stop + 1] for out in outs), **kwargs)
+
+    run_blocks(compute, length - 1, nthreads)
+    return outs[0] if single else outs
+
 def _makearray(a):
     new = asarray(a)
     wrap = getattr(a, "__array_prepare__", new.__array_wrap__)
@@ -316,7 +378,7 @@ def tensorsolve(a, b, axes=None):
     res.shape = oldshape
     return res
 
-def solve(a, b):
+def solve(a, b, mixed_precision=False):
     """
     Solve a linear matrix equation, or system of linear scalar equations.
 
@@ -329,6 +391,13 @@ def solve(a, b):
         Coefficient matrix.
     b : {(..., M,), (..., M, K)}, array_like
         Ordinate or "dependent variable" values.
+    mixed_precision : bool, optional
+        If True, factor `a` in single precision and refine the solution
+        with residuals computed in double precision. This is faster for
+        large matrices that are not too badly conditioned, and gives a
+        solution as accurate as the default. Default is False.
+
+        .. versionadded:: 1.15.0
 
     Returns
     -------
@@ -348,7 +417,14 @@ def solve(a, b):
     Broadcasting rules apply, see the `numpy.linalg` documentation for
     details.
 
-    The solutions are computed using LAPACK routine _gesv
+    The solutions are computed using LAPACK routine _gesv. With
+    `mixed_precision`, they are computed as by the LAPACK routines dsgesv and
+    zcgesv instead: the single precision LU factorization of `a` is used to
+    correct the solution until its residual is at the level of double
+    precision rounding errors. If `a` is too large for single precision,
+    singular in single precision or too badly conditioned for the correction
+    to converge in 30 steps, the system is solved again with _gesv, so the
+    option never costs accuracy.
 
     `a` must be square and of full-rank, i.e., all rows (or, equivalently,
     columns) must be linearly independent; if either is not true, use
@@ -385,13 +461,19 @@ def solve(a, b):
     # We use the b = (..., M,) logic, only if the number of extra dimensions
     # match exactly
     if b.ndim == a.ndim - 1:
-        gufunc = _umath_linalg.solve1
+        if mixed_precision:
+            gufunc = _umath_linalg.solve1_refine
+        else:
+            gufunc = _umath_linalg.solve1
     else:
-        gufunc = _umath_linalg.solve
+        if mixed_precision:
+            gufunc = _umath_linalg.solve_refine
+        else:
+            gufunc = _umath_linalg.solve
 
     signature = 'DD->D' if isComplexType(t) else 'dd->d'
     extobj = get_linalg_error_extobj(_raise_linalgerror_singular)
-    r = gufunc(a, b, signature=signature, extobj=extobj)
+    r = _stacked_gufunc(gufunc, a, b, signature=signature, extobj=extobj)
 
     return wrap(r.astype(result_t, copy=False))
 
@@ -529,7 +611,8 @@ def inv(a):
 
     signature = 'D->D' if isComplexType(t) else 'd->d'
     extobj = get_linalg_error_extobj(_raise_linalgerror_singular)
-    ainv = _umath_linalg.inv(a, signature=signature, extobj=extobj)
+    ainv = _stacked_gufunc(_umath_linalg.inv, a, signature=signature,
+                           extobj=extobj)
     return wrap(ainv.astype(result_t, copy=False))
 
 
@@ -721,6 +804,222 @@ def cholesky(a):
     r = gufunc(a, signature=signature, extobj=extobj)
     return wrap(r.astype(result_t, copy=False))
 
+
+# Factorizations for repeated solves
+
+def lu_factor(a):
+    """
+    LU decomposition with partial pivoting, for solving with `lu_solve`.
+
+    Parameters
+    ----------
+    a : (..., M, M) array_like
+        Matrix to decompose.
+
+    Returns
+    -------
+    lu : (..., M, M) ndarray
+        The factors of ``P a = L U`` in one matrix: `U` in the upper
+        triangle and `L` below the diagonal, whose unit diagonal is not
+        stored.
+    piv : (..., M) ndarray of intc
+        The pivot indices describing `P`: row ``i`` of `a` was interchanged
+        with row ``piv[i]``, for ``i = 0, ..., M-1`` in order.
+
+    Raises
+    ------
+    LinAlgError
+        If `a` is singular or not square.
+
+    See Also
+    --------
+    lu_solve : Solve a linear system with the factorization.
+    solve : Factor and solve in one call.
+
+    Notes
+    -----
+
+    .. versionadded:: 1.15.0
+
+    Broadcasting rules apply, see the `numpy.linalg` documentation for
+    details.
+
+    The decomposition is computed using LAPACK routine _getrf. Solving with
+    it in `lu_solve` takes ``O(M**2)`` operations, instead of the
+    ``O(M**3)`` of `solve`, which factors `a` again on every call.
+
+    Examples
+    --------
+    >>> a = np.array([[3., 1.], [1., 2.]])
+    >>> lu_piv = np.linalg.lu_factor(a)
+    >>> np.linalg.lu_solve(lu_piv, [9., 8.])
+    array([ 2.,  3.])
+    >>> np.linalg.lu_solve(lu_piv, [4., 3.])
+    array([ 1.,  1.])
+
+    """
+    a, wrap = _makearray(a)
+    _assertRankAtLeast2(a)
+    _assertNdSquareness(a)
+    t, result_t = _commonType(a)
+    signature = 'D->Di' if isComplexType(t) else 'd->di'
+    extobj = get_linalg_error_extobj(_raise_linalgerror_singular)
+    lu, piv = _stacked_gufunc(_umath_linalg.lu_factor, a,
+                              signature=signature, extobj=extobj)
+    return wrap(lu.astype(result_t, copy=False)), piv
+
+
+def lu_solve(lu_and_piv, b):
+    """
+    Solve a linear system given the LU decomposition from `lu_factor`.
+
+    Parameters
+    ----------
+    lu_and_piv : tuple of ndarrays
+        The factors `lu` and pivots `piv` of the coefficient matrix, as
+        returned by `lu_factor`.
+    b : {(..., M,), (..., M, K)}, array_like
+        Ordinate or "dependent variable" values.
+
+    Returns
+    -------
+    x : {(..., M,), (..., M, K)} ndarray
+        Solution to the system a x = b.  Returned shape is identical to `b`.
+
+    Raises
+    ------
+    ValueError
+        If a pivot index is out of range.
+
+    See Also
+    --------
+    lu_factor : Compute the decomposition.
+
+    Notes
+    -----
+
+    .. versionadded:: 1.15.0
+
+    Broadcasting rules apply, see the `numpy.linalg` documentation for
+    details.
+
+    The solutions are computed using LAPACK routine _getrs.
+
+    """
+    lu, piv = lu_and_piv
+    lu, _ = _makearray(lu)
+    _assertRankAtLeast2(lu)
+    _assertNdSquareness(lu)
+    piv = asarray(piv)
+    b, wrap = _makearray(b)
+    t, result_t = _commonType(lu, b)
+    if piv.size and (amin(piv) < 0 or amax(piv) >= lu.shape[-1]):
+        raise ValueError("pivot indices out of range")
+
+    # as in solve, b is a stack of vectors only if its extra dimensions
+    # match exactly
+    if b.ndim == lu.ndim - 1:
+        gufunc = _umath_linalg.lu_solve1
+    else:
+        gufunc = _umath_linalg.lu_solve
+
+    signature = 'DiD->D' if isComplexType(t) else 'did->d'
+    r = _stacked_gufunc(gufunc, lu, piv, b, signature=signature)
+    return wrap(r.astype(result_t, copy=False))
+
+
+def cho_factor(a):
+    """
+    Cholesky decomposition, for solving with `cho_solve`.
+
+    This is `cholesky`, under a name pairing it with `cho_solve`.
+
+    Parameters
+    ----------
+    a : (..., M, M) array_like
+        Hermitian (symmetric if all elements are real), positive-definite
+        input matrix.
+
+    Returns
+    -------
+    L : (..., M, M) ndarray
+        Lower-triangular Cholesky factor of `a`.
+
+    Raises
+    ------
+    LinAlgError
+       If the decomposition fails, for example, if `a` is not
+       positive-definite.
+
+    See Also
+    --------
+    cho_solve : Solve a linear system with the factorization.
+
+    Notes
+    -----
+
+    .. versionadded:: 1.15.0
+
+    Examples
+    --------
+    >>> a = np.array([[4., 2.], [2., 3.]])
+    >>> L = np.linalg.cho_factor(a)
+    >>> np.linalg.cho_solve(L, [8., 7.])
+    array([ 1.25,  1.5 ])
+
+    """
+    return cholesky(a)
+
+
+def cho_solve(L, b):
+    """
+    Solve a linear system given the Cholesky factor from `cho_factor`.
+
+    Parameters
+    ----------
+    L : (..., M, M) array_like
+        Lower-triangular Cholesky factor of the coefficient matrix, as
+        returned by `cho_factor` or `cholesky`.  The upper triangle is not
+        used.
+    b : {(..., M,), (..., M, K)}, array_like
+        Ordinate or "dependent variable" values.
+
+    Returns
+    -------
+    x : {(..., M,), (..., M, K)} ndarray
+        Solution to the system a x = b, with ``a = L L.H``.  Returned shape
+        is identical to `b`.
+
+    See Also
+    --------
+    cho_factor : Compute the decomposition.
+
+    Notes
+    -----
+
+    .. versionadded:: 1.15.0
+
+    Broadcasting rules apply, see the `numpy.linalg` documentation for
+    details.
+
+    The solutions are computed using LAPACK routine _potrs.
+
+    """
+    L, _ = _makearray(L)
+    _assertRankAtLeast2(L)
+    _assertNdSquareness(L)
+    b, wrap = _makearray(b)
+    t, result_t = _commonType(L, b)
+
+    if b.ndim == L.ndim - 1:
+        gufunc = _umath_linalg.cho_solve1
+    else:
+        gufunc = _umath_linalg.cho_solve
+
+    signature = 'DD->D' if isComplexType(t) else 'dd->d'
+    r = _stacked_gufunc(gufunc, L, b, signature=signature)
+    return wrap(r.astype(result_t, copy=False))
+
 # QR decompostion
 
 def qr(a, mode='reduced'):
@@ -1025,7 +1324,7 @@ def eigvals(a):
 
     return w.astype(result_t, copy=False)
 
-def eigvalsh(a, UPLO='L'):
+def eigvalsh(a, UPLO='L', subset_by_index=None):
     """
     Compute the eigenvalues of a Hermitian or real symmetric matrix.
 
@@ -1043,12 +1342,18 @@ def eigvalsh(a, UPLO='L'):
         be considered in the computation to preserve the notion of a Hermitian
         matrix. It therefore follows that the imaginary part of the diagonal
         will always be treated as zero.
+    subset_by_index : (int, int), optional
+        If given, the inclusive indices ``(lo, hi)`` of the eigenvalues to
+        compute, ``0 <= lo <= hi < M``, in ascending order.
+
+        .. versionadded:: 1.15.0
 
     Returns
     -------
     w : (..., M,) ndarray
         The eigenvalues in ascending order, each repeated according to
-        its multiplicity.
+        its multiplicity. Only the ``hi - lo + 1`` eigenvalues
+        ``w[..., lo:hi+1]`` if `subset_by_index` is given.
 
     Raises
     ------
@@ -1070,7 +1375,9 @@ def eigvalsh(a, UPLO='L'):
     Broadcasting rules apply, see the `numpy.linalg` documentation for
     details.
 
-    The eigenvalues are computed using LAPACK routines _syevd, _heevd
+    The eigenvalues are computed using LAPACK routines _syevd, _heevd. A
+    subset of them is computed by reducing `a` to tridiagonal form with
+    _sytrd, _hetrd, and finding the eigenvalues of that with _sterf.
 
     Examples
     --------
@@ -1112,8 +1419,10 @@ def eigvalsh(a, UPLO='L'):
     _assertRankAtLeast2(a)
     _assertNdSquareness(a)
     t, result_t = _commonType(a)
+    if subset_by_index is not None:
+        return _eigh_subset(a, UPLO, subset_by_index, False, t, result_t)
     signature = 'D->d' if isComplexType(t) else 'd->d'
-    w = gufunc(a, signature=signature, extobj=extobj)
+    w = _stacked_gufunc(gufunc, a, signature=signature, extobj=extobj)
     return w.astype(_realType(result_t), copy=False)
 
 def _convertarray(a):
@@ -1266,7 +1575,39 @@ def eig(a):
     return w.astype(result_t, copy=False), wrap(vt)
 
 
-def eigh(a, UPLO='L'):
+def _eigh_subset(a, UPLO, subset_by_index, compute_v, t, result_t):
+    """
+    Eigenvalues ``lo`` to ``hi`` of the hermitian matrices `a`, and their
+    eigenvectors if `compute_v`, for `eigh` and `eigvalsh`.
+    """
+    m = a.shape[-1]
+    lo, hi = (operator.index(i) for i in subset_by_index)
+    if not 0 <= lo <= hi < m:
+        raise ValueError("subset_by_index must satisfy 0 <= lo <= hi < M, "
+                         "got ({}, {}) for M = {}".format(lo, hi, m))
+
+    extobj = get_linalg_error_extobj(
+        _raise_linalgerror_eigenvalues_nonconvergence)
+    real_t = _realType(t)
+    w = empty(a.shape[:-2] + (hi - lo + 1,), dtype=real_t)
+    if not compute_v:
+        gufunc = (_umath_linalg.eigvalsh_subset_lo if UPLO == 'L' else
+                  _umath_linalg.eigvalsh_subset_up)
+        signature = 'Di->d' if isComplexType(t) else 'di->d'
+        gufunc(a, fortran_int(lo), w, signature=signature, extobj=extobj)
+        return w.astype(_realType(result_t), copy=False)
+
+    gufunc = (_umath_linalg.eigh_subset_lo if UPLO == 'L' else
+              _umath_linalg.eigh_subset_up)
+    signature = 'Di->dD' if isComplexType(t) else 'di->dd'
+    vt = empty(a.shape[:-1] + (hi - lo + 1,), dtype=t)
+    gufunc(a, fortran_int(lo), w, vt, signature=signature, extobj=extobj)
+    w = w.astype(_realType(result_t), copy=False)
+    vt = vt.astype(result_t, copy=False)
+    return w, vt
+
+
+def eigh(a, UPLO='L', subset_by_index=None):
     """
     Return the eigenvalues and eigenvectors of a Hermitian or symmetric matrix.
 
@@ -1286,16 +1627,24 @@ def eigh(a, UPLO='L'):
         be considered in the computation to preserve the notion of a Hermitian
         matrix. It therefore follows that the imaginary part of the diagonal
         will always be treated as zero.
+    subset_by_index : (int, int), optional
+        If given, the inclusive indices ``(lo, hi)`` of the eigenvalues to
+        compute, ``0 <= lo <= hi < M``, in ascending order, together with
+        their eigenvectors. The memory needed besides a copy of `a` is then
+        proportional to the number ``K = hi - lo + 1`` of eigenvectors.
+
+        .. versionadded:: 1.15.0
 
     Returns
     -------
-    w : (..., M) ndarray
+    w : (..., M) or (..., K) ndarray
         The eigenvalues in ascending order, each repeated according to
         its multiplicity.
     v : {(..., M, M) ndarray, (..., M, M) matrix}
         The column ``v[:, i]`` is the normalized eigenvector corresponding
         to the eigenvalue ``w[i]``.  Will return a matrix object if `a` is
-        a matrix object.
+        a matrix object. The shape is ``(..., M, K)`` if `subset_by_index`
+        is given.
 
     Raises
     ------
@@ -1317,7 +1666,10 @@ def eigh(a, UPLO='L'):
     details.
 
     The eigenvalues/eigenvectors are computed using LAPACK routines _syevd,
-    _heevd
+    _heevd. With `subset_by_index`, `a` is reduced to tridiagonal form with
+    _sytrd, _hetrd, the eigenvalues of that are found with _sterf and the
+    wanted eigenvectors by inverse iteration, then transformed back with
+    _ormtr, _unmtr.
 
     The eigenvalues of real symmetric or complex Hermitian matrices are
     always real. [1]_ The array `v` of (column) eigenvectors is unitary
@@ -1386,6 +1738,9 @@ def eigh(a, UPLO='L'):
     _assertRankAtLeast2(a)
     _assertNdSquareness(a)
     t, result_t = _commonType(a)
+    if subset_by_index is not None:
+        w, vt = _eigh_subset(a, UPLO, subset_by_index, True, t, result_t)
+        return w, wrap(vt)
 
     extobj = get_linalg_error_extobj(
         _raise_linalgerror_eigenvalues_nonconvergence)
@@ -1395,7 +1750,7 @@ def eigh(a, UPLO='L'):
         gufunc = _umath_linalg.eigh_up
 
     signature = 'D->dD' if isComplexType(t) else 'd->dd'
-    w, vt = gufunc(a, signature=signature, extobj=extobj)
+    w, vt = _stacked_gufunc(gufunc, a, signature=signature, extobj=extobj)
     w = w.astype(_realType(result_t), copy=False)
     vt = vt.astype(result_t, copy=False)
     return w, wrap(vt)
@@ -1547,7 +1902,8 @@ def svd(a, full_matrices=True, compute_uv=True):
                 gufunc = _umath_linalg.svd_n_s
 
         signature = 'D->DdD' if isComplexType(t) else 'd->ddd'
-        u, s, vh = gufunc(a, signature=signature, extobj=extobj)
+        u, s, vh = _stacked_gufunc(gufunc, a, signature=signature,
+                                   extobj=extobj)
         u = u.astype(result_t, copy=False)
         s = s.astype(_realType(result_t), copy=False)
         vh = vh.astype(result_t, copy=False)
@@ -1559,11 +1915,123 @@ def svd(a, full_matrices=True, compute_uv=True):
             gufunc = _umath_linalg.svd_n
 
         signature = 'D->d' if isComplexType(t) else 'd->d'
-        s = gufunc(a, signature=signature, extobj=extobj)
+        s = _stacked_gufunc(gufunc, a, signature=signature, extobj=extobj)
         s = s.astype(_realType(result_t), copy=False)
         return s
 
 
+def randomized_svd(a, k, n_oversamples=10, n_iter=4, random_state=None):
+    """
+    Truncated Singular Value Decomposition by random projections.
+
+    Computes approximations of the `k` largest singular values of `a` and
+    of their singular vectors, much faster than `svd` when `k` is small
+    compared to the dimensions of `a`. The range of `a` is sampled by
+    multiplying it with a random matrix of ``k + n_oversamples`` columns,
+    refined with `n_iter` power iterations, and `a` is projected on an
+    orthonormal basis of it, the SVD of which is then computed exactly.
+
+    Parameters
+    ----------
+    a : (M, N) array_like
+        A real or complex matrix.
+    k : int
+        Number of singular values and vectors to compute,
+        ``0 < k <= min(M, N)``.
+    n_oversamples : int, optional
+        Number of extra samples of the range of `a`, which improve the
+        accuracy of the smallest of the `k` singular values. Default is 10.
+    n_iter : int, optional
+        Number of power iterations. Each costs two products with `a`, and
+        makes the result more accurate when the singular values of `a` decay
+        slowly. Default is 4.
+    random_state : {None, int, RandomState}, optional
+        Source of the random matrix. An integer seeds a new RandomState,
+        and None uses a fresh unseeded one.
+
+    Returns
+    -------
+    u : (M, k) ndarray
+        Unitary matrix having the approximate left singular vectors as
+        columns.
+    s : (k,) ndarray
+        The approximate singular values, in descending order.
+    vh : (k, N) ndarray
+        Unitary matrix having the approximate right singular vectors as
+        rows.
+
+    Raises
+    ------
+    LinAlgError
+        If the SVD computation does not converge.
+
+    See Also
+    --------
+    svd : the full singular value decomposition.
+
+    Notes
+    -----
+
+    .. versionadded:: 1.15.0
+
+    Only the products of `a` with matrices of ``k + n_oversamples`` columns
+    are computed, so that `a` is never copied when it already has the
+    precision of the results. The power iterations are orthonormalized
+    with `qr` to keep the small singular values accurate. The result is
+    exact if the rank of `a` is at most ``k + n_oversamples``.
+
+    References
+    ----------
+    .. [1] N. Halko, P. G. Martinsson and J. A. Tropp, "Finding structure
+           with randomness: Probabilistic algorithms for constructing
+           approximate matrix decompositions", SIAM Review, 53(2), 2011.
+
+    Examples
+    --------
+    >>> a = np.outer(np.arange(1, 7), np.arange(1, 5)) + np.eye(6, 4)
+    >>> u, s, vh = np.linalg.randomized_svd(a, 2, random_state=0)
+    >>> np.allclose(s, np.linalg.svd(a, compute_uv=False)[:2])
+    True
+    >>> u.shape, vh.shape
+    ((6, 2), (2, 4))
+
+    """
+    a, wrap = _makearray(a)
+    _assertRank2(a)
+    _assertNoEmpty2d(a)
+    t, result_t = _commonType(a)
+    m, n = a.shape
+    k = operator.index(k)
+    if not 0 < k <= min(m, n):
+        raise ValueError("k must satisfy 0 < k <= min(M, N), got {} for "
+                         "({}, {})".format(k, m, n))
+    n_oversamples = operator.index(n_oversamples)
+    n_iter = operator.index(n_iter)
+    if n_oversamples < 0 or n_iter < 0:
+        raise ValueError("n_oversamples and n_iter must be non-negative")
+
+    from numpy.random import RandomState
+    if not isinstance(random_state, RandomState):
+        random_state = RandomState(random_state)
+    samples = min(k + n_oversamples, m, n)
+    omega = random_state.standard_normal((n, samples)).astype(t)
+    if isComplexType(t):
+        omega += 1j * random_state.standard_normal((n, samples))
+
+    # a^H q is formed as (q^H a)^H so that a is not conjugated
+    q = qr(matmul(a, omega))[0]
+    for i in range(n_iter):
+        z = qr(matmul(q.T.conj(), a).T.conj())[0]
+        q = qr(matmul(a, z))[0]
+
+    ub, s, vh = svd(matmul(q.T.conj(), a), full_matrices=False)
+    u = matmul(q, ub[:, :k])
+    u = u.astype(result_t, copy=False)
+    s = s[:k].astype(_realType(result_t), copy=False)
+    vh = vh[:k].astype(result_t, copy=False)
+    return wrap(u), s, wrap(vh)
+
+
 def cond(x, p=None):
     """
     Compute the condition number of a matrix.
@@ -1950,7 +2418,8 @@ def slogdet(a):
     t, result_t = _commonType(a)
     real_t = _realType(result_t)
     signature = 'D->Dd' if isComplexType(t) else 'd->dd'
-    sign, logdet = _umath_linalg.slogdet(a, signature=signature)
+    sign, logdet = _stacked_gufunc(_umath_linalg.slogdet, a,
+                                   signature=signature)
     sign = sign.astype(result_t, copy=False)
     logdet = logdet.astype(real_t, copy=False)
     return sign, logdet
@@ -2007,7 +2476,7 @@ def det(a):
     _assertNdSquareness(a)
     t, result_t = _commonType(a)
     signature = 'D->D' if isComplexType(t) else 'd->d'
-    r = _umath_linalg.det(a, signature=signature)
+    r = _stacked_gufunc(_umath_linalg.det, a, signature=signature)
     r = r.astype(result_t, copy=False)
     return r
 
@@ -21,16 +21,21 @@ def configuration(parent_package='', top_path=None):
         os.path.join(src_dir, 'f2c_s_lapack.c'),
         os.path.join(src_dir, 'f2c_lapack.c'),
         os.path.join(src_dir, 'f2c_blas.c'),
+        os.path.join(src_dir, 'blocked_blas.c.src'),
         os.path.join(src_dir, 'f2c_config.c'),
         os.path.join(src_dir, 'f2c.c'),
     ]
     all_sources = config.paths(lapack_lite_src)
+    # blocked_blas.c is generated in the build tree but includes f2c.h
+    lite_include_dir = config.paths(src_dir)[0]
 
     lapack_info = get_info('lapack_opt', 0)  # and {}
 
     def get_lapack_lite_sources(ext, build_dir):
         if not lapack_info:
             print("### Warning:  Using unoptimized lapack ###")
+            if lite_include_dir not in ext.include_dirs:
+                ext.include_dirs.append(lite_include_dir)
             return all_sources
         else:
             if sys.platform == 'win32':
@@ -521,6 +521,43 @@ class TestSolve(SolveCases):
         assert_(isinstance(result, ArraySubclass))
 
 
+class TestSolveMixedPrecision(SolveCases):
+    def do(self, a, b, tags):
+        x = linalg.solve(a, b, mixed_precision=True)
+        assert_almost_equal(b, dot_generalized(a, x))
+        assert_(consistent_subclass(x, b))
+        assert_equal(x.dtype, linalg.solve(a, b).dtype)
+
+    def test_refined_to_double_precision(self):
+        np.random.seed(1234)
+        for dtype in [double, cdouble]:
+            a = np.random.randn(3, 60, 60).astype(dtype)
+            b = np.random.randn(3, 60, 2).astype(dtype)
+            if dtype == cdouble:
+                a += 1j * np.random.randn(3, 60, 60)
+                b += 1j * np.random.randn(3, 60, 2)
+            for bb in [b, b[..., 0]]:
+                assert_allclose(linalg.solve(a, bb, mixed_precision=True),
+                                linalg.solve(a, bb), rtol=1e-10, atol=0)
+
+    def test_fallback(self):
+        # too badly conditioned for refinement from single precision
+        n = 12
+        hilbert = 1. / (np.arange(n)[:, None] + np.arange(n) + 1)
+        b = np.ones(n)
+        assert_allclose(linalg.solve(hilbert, b, mixed_precision=True),
+                        linalg.solve(hilbert, b))
+        # out of the range of single precision
+        a = np.array([[2e40, 1e40], [1e40, 3e40]])
+        assert_allclose(linalg.solve(a, b[:2], mixed_precision=True),
+                        linalg.solve(a, b[:2]))
+        assert_raises(LinAlgError, linalg.solve, np.ones((3, 3)), b[:3],
+                      mixed_precision=True)
+        x = linalg.solve(np.array([[np.nan, 1], [1, 1]]), b[:2],
+                         mixed_precision=True)
+        assert_(np.isnan(x).all())
+
+
 class InvCases(LinalgSquareTestCase, LinalgGeneralizedSquareTestCase):
 
     def do(self, a, b, tags):
@@ -681,6 +718,46 @@ class TestSVD(SVDCases):
         assert_raises(linalg.LinAlgError, linalg.svd, a)
 
 
+class TestRandomizedSVD(object):
+    def test_low_rank(self):
+        # exact when the rank is at most k + n_oversamples
+        rng = np.random.RandomState(0)
+        for dtype in [single, double, csingle, cdouble]:
+            x = rng.randn(60, 5).dot(rng.randn(5, 40)).astype(dtype)
+            if issubclass(dtype, np.complexfloating):
+                x *= 1 + 1j
+            u, s, vh = linalg.randomized_svd(x, 3, random_state=1)
+            assert_equal(u.dtype, dtype)
+            assert_equal(s.dtype, get_real_dtype(dtype))
+            assert_equal(vh.dtype, dtype)
+            assert_equal((u.shape, s.shape, vh.shape),
+                         ((60, 3), (3,), (3, 40)))
+            rtol = get_rtol(dtype)
+            s_full = linalg.svd(x, compute_uv=False)
+            assert_allclose(s, s_full[:3], rtol=rtol)
+            assert_allclose(u.T.conj().dot(u), np.eye(3), atol=rtol)
+            assert_allclose(vh.dot(vh.T.conj()), np.eye(3), atol=rtol)
+            u, s, vh = linalg.randomized_svd(x, 5, random_state=1)
+            assert_allclose((u * s).dot(vh), x, atol=rtol * s_full[0])
+
+    def test_random_state(self):
+        x = np.random.RandomState(0).randn(30, 20)
+        res1 = linalg.randomized_svd(x, 2, n_oversamples=0, n_iter=1,
+                                     random_state=5)
+        res2 = linalg.randomized_svd(x, 2, n_oversamples=0, n_iter=1,
+                                     random_state=np.random.RandomState(5))
+        for r1, r2 in zip(res1, res2):
+            assert_equal(r1, r2)
+
+    def test_invalid(self):
+        x = np.ones((4, 3))
+        assert_raises(ValueError, linalg.randomized_svd, x, 0)
+        assert_raises(ValueError, linalg.randomized_svd, x, 4)
+        assert_raises(ValueError, linalg.randomized_svd, x, 2, n_iter=-1)
+        assert_raises(linalg.LinAlgError, linalg.randomized_svd,
+                      np.ones((2, 3, 3)), 2)
+
+
 class CondCases(LinalgSquareTestCase, LinalgGeneralizedSquareTestCase):
     # cond(x, p) for p in (None, 2, -2)
 
@@ -1089,6 +1166,27 @@ class TestEighCases(HermitianTestCase, HermitianGeneralizedTestCase):
                         rtol=get_rtol(ev.dtype), err_msg=repr(a))
 
 
+class TestEighSubsetCases(HermitianTestCase, HermitianGeneralizedTestCase):
+
+    def do(self, a, b, tags):
+        m = np.asarray(a).shape[-1]
+        if m == 0:
+            return
+        lo, hi = m // 3, m - 1
+        ev, evc = linalg.eigh(a)
+        for UPLO in 'LU':
+            w, v = linalg.eigh(a, UPLO, subset_by_index=(lo, hi))
+            assert_equal(v.shape, np.asarray(a).shape[:-1] + (hi - lo + 1,))
+            assert_allclose(w, ev[..., lo:hi+1], rtol=get_rtol(ev.dtype),
+                            atol=get_rtol(ev.dtype) * abs(ev).max())
+            assert_allclose(dot_generalized(a, v),
+                            np.asarray(w)[..., None, :] * np.asarray(v),
+                            rtol=get_rtol(ev.dtype),
+                            atol=get_rtol(ev.dtype) * abs(ev).max())
+            assert_equal(linalg.eigvalsh(a, UPLO, subset_by_index=(lo, hi)),
+                         w)
+
+
 class TestEigh(object):
     def test_types(self):
         def check(dtype):
@@ -1127,6 +1225,22 @@ class TestEigh(object):
         w, v = np.linalg.eigh(Kup, UPLO='u')
         assert_allclose(w, tgt, rtol=rtol)
 
+    def test_subset_by_index(self):
+        # repeated eigenvalues need orthogonal eigenvectors
+        q, r = np.linalg.qr(np.random.RandomState(3).randn(8, 8))
+        a = (q * [1, 1, 1, 2, 2, 2, 3, 4]).dot(q.T)
+        for lo, hi in [(0, 0), (0, 7), (2, 4), (7, 7)]:
+            w, v = np.linalg.eigh(a, subset_by_index=(lo, hi))
+            assert_allclose(w, [1, 1, 1, 2, 2, 2, 3, 4][lo:hi+1], atol=1e-12)
+            assert_allclose(a.dot(v), v * w, atol=1e-12)
+            assert_allclose(v.T.dot(v), np.eye(hi - lo + 1), atol=1e-12)
+
+        for subset in [(-1, 2), (2, 1), (0, 8)]:
+            assert_raises(ValueError, np.linalg.eigh, a,
+                          subset_by_index=subset)
+            assert_raises(ValueError, np.linalg.eigvalsh, a,
+                          subset_by_index=subset)
+
     def test_0_size(self):
         # Check that all kinds of 0-sized arrays work
         class ArraySubclass(np.ndarray):
@@ -1679,6 +1793,84 @@ class TestCholesky(object):
         assert_(isinstance(res, np.ndarray))
 
 
+class LUSolveCases(LinalgSquareTestCase, LinalgGeneralizedSquareTestCase):
+
+    def do(self, a, b, tags):
+        x = linalg.lu_solve(linalg.lu_factor(a), b)
+        assert_almost_equal(b, dot_generalized(a, x))
+        assert_(consistent_subclass(x, b))
+
+
+class TestLUSolve(LUSolveCases):
+    def test_types(self):
+        def check(dtype):
+            x = np.array([[1, 0.5], [0.5, 1]], dtype=dtype)
+            lu, piv = linalg.lu_factor(x)
+            assert_equal(lu.dtype, dtype)
+            assert_equal(piv.dtype, np.intc)
+            assert_equal(linalg.lu_solve((lu, piv), x).dtype, dtype)
+        for dtype in [single, double, csingle, cdouble]:
+            check(dtype)
+
+    def test_factors(self):
+        # P a = L U with the row interchanges of piv
+        np.random.seed(1)
+        a = np.random.randn(3, 6, 6)
+        lu, piv = linalg.lu_factor(a)
+        for k in range(3):
+            pa = a[k].copy()
+            for i, p in enumerate(piv[k]):
+                pa[[i, p]] = pa[[p, i]]
+            l = np.tril(lu[k], -1) + np.eye(6)
+            assert_allclose(np.dot(l, np.triu(lu[k])), pa, atol=1e-12)
+            assert_array_equal(linalg.lu_factor(a[k])[1], piv[k])
+
+    def test_errors(self):
+        assert_raises(linalg.LinAlgError, linalg.lu_factor, np.ones((3, 3)))
+        assert_raises(linalg.LinAlgError, linalg.lu_factor, np.ones((3, 2)))
+        lu, piv = linalg.lu_factor(np.eye(3))
+        assert_raises(ValueError, linalg.lu_solve, (lu, piv + 3), np.ones(3))
+        assert_raises(ValueError, linalg.lu_solve, (lu, piv - 1), np.ones(3))
+
+    def test_0_size(self):
+        lu, piv = linalg.lu_factor(np.zeros((2, 0, 0)))
+        assert_equal(lu.shape, (2, 0, 0))
+        assert_equal(piv.shape, (2, 0))
+        assert_equal(linalg.lu_solve((lu, piv), np.zeros((2, 0, 3))).shape,
+                     (2, 0, 3))
+
+
+class TestChoSolve(object):
+
+    def test_basic_property(self):
+        shapes = [(1, 1), (3, 3), (20, 20), (3, 10, 10)]
+        dtypes = (np.float32, np.float64, np.complex64, np.complex128)
+
+        for shape, dtype in itertools.product(shapes, dtypes):
+            np.random.seed(1)
+            a = np.random.randn(*shape)
+            if np.issubdtype(dtype, np.complexfloating):
+                a = a + 1j*np.random.randn(*shape)
+            a = np.matmul(np.swapaxes(a, -1, -2).conj(), a) + np.eye(shape[-1])
+            a = np.asarray(a, dtype=dtype)
+            b = np.asarray(np.random.randn(*shape[:-1]), dtype=dtype)
+
+            c = linalg.cho_factor(a)
+            assert_equal(c.dtype, dtype)
+            for rhs in [b, b[..., None], np.stack([b, 2*b], axis=-1)]:
+                x = linalg.cho_solve(c, rhs)
+                assert_equal(x.dtype, dtype)
+                assert_allclose(np.matmul(a, x) if rhs.ndim == a.ndim
+                                else np.matmul(a, x[..., None])[..., 0],
+                                rhs, rtol=get_rtol(dtype), atol=get_rtol(dtype))
+
+        # only the lower triangle of the factor is used
+        c = linalg.cho_factor(np.array([[4., 2.], [2., 3.]]))
+        c[0, 1] = np.nan
+        assert_allclose(linalg.cho_solve(c, [8., 7.]), [1.25, 1.5])
+
+
+
 def test_byteorder_check():
     # Byte order check should pass for native order
     if sys.byteorder == 'little':
@@ -1714,6 +1906,194 @@ def test_generalized_raise_multiloop():
     assert_raises(np.linalg.LinAlgError, np.linalg.inv, x)
 
 
+def test_stacked_threads():
+    # stacks split between threads give the same result as one thread
+    mod = np.linalg.linalg
+    rng = np.random.RandomState(1234)
+    a = rng.randn(7, 3, 5, 5) + 5*np.eye(5)
+    h = a + np.swapaxes(a, -1, -2)
+    b = rng.randn(7, 3, 5, 2)
+    calls = [(np.linalg.solve, (a, b)), (np.linalg.solve, (a, b[:1])),
+             (np.linalg.solve, (a[:1], b)), (np.linalg.solve, (a, b[..., 0])),
+             (np.linalg.inv, (a,)), (np.linalg.det, (a,)),
+             (np.linalg.slogdet, (a.astype(np.complex64),)),
+             (np.linalg.eigh, (h,)), (np.linalg.eigvalsh, (h,)),
+             (np.linalg.svd, (a[..., :3],)),
+             (lambda x: np.linalg.svd(x, compute_uv=False), (a,))]
+    old = mod._linalg_threads, mod._linalg_thread_work
+    try:
+        mod._linalg_threads, mod._linalg_thread_work = 1, 1
+        expected = [f(*args) for f, args in calls]
+        mod._linalg_threads = 4
+        for (f, args), exp in zip(calls, expected):
+            res = f(*args)
+            if not isinstance(res, tuple):
+                res, exp = (res,), (exp,)
+            for r, e in zip(res, exp):
+                assert_equal(r.dtype, e.dtype)
+                assert_array_equal(r, e)
+
+        # errors in any block are raised
+        x = np.tile(np.eye(2), (8, 1, 1))
+        x[5] = 0
+        assert_raises(LinAlgError, np.linalg.inv, x)
+        assert_raises(ValueError, np.linalg.solve, a, rng.randn(4, 3, 5, 2))
+    finally:
+        mod._linalg_threads, mod._linalg_thread_work = old
+
+
+def test_work_query_threads():
+    # the work sizes are cached per thread, so threads calling LAPACK on
+    # different shapes at the same time do not get each other's sizes
+    import threading
+    rng = np.random.RandomState(1234)
+    calls = []
+    for n in [5, 9, 17, 33, 65]:
+        a = rng.randn(4, n, n)
+        h = a + np.swapaxes(a, -1, -2)
+        calls += [(np.linalg.eigh, h), (np.linalg.eigvalsh, h),
+                  (np.linalg.eig, a), (np.linalg.svd, a[..., :n//2 + 1]),
+                  (np.linalg.svd, h.astype(np.complex64))]
+    expected = [f(a) for f, a in calls]
+    errors = []
+
+    def worker(order):
+        try:
+            for repeat in range(3):
+                for i in order:
+                    res, exp = calls[i][0](calls[i][1]), expected[i]
+                    if not isinstance(res, tuple):
+                        res, exp = (res,), (exp,)
+                    for r, e in zip(res, exp):
+                        assert_allclose(r, e, rtol=1e-4, atol=1e-4)
+        except Exception as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker,
+                                args=(rng.permutation(len(calls)),))
+               for i in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert_equal(errors, [])
+
+
+def test_small_closed_forms():
+    # real matrices up to 4x4 use closed forms, compare with LAPACK through
+    # the complex types and check that near singular ones still go to LAPACK
+    rng = np.random.RandomState(1234)
+    for dtype, rtol in [(np.float32, 1e-4), (np.float64, 1e-10)]:
+        for n in range(1, 5):
+            a = rng.randn(10, n, n).astype(dtype)
+            b = rng.randn(10, n, 2).astype(dtype)
+            c = a.astype(np.complex128)
+            h = a + np.swapaxes(a, -1, -2)
+            assert_allclose(np.linalg.det(a), np.linalg.det(c).real,
+                            rtol=rtol, atol=rtol)
+            sign, logdet = np.linalg.slogdet(a)
+            assert_equal(sign, np.linalg.slogdet(c)[0].real)
+            assert_allclose(logdet, np.linalg.slogdet(c)[1],
+                            rtol=rtol, atol=rtol)
+            assert_allclose(np.linalg.inv(a), np.linalg.inv(c).real,
+                            rtol=100*rtol, atol=100*rtol)
+            assert_allclose(np.linalg.solve(a, b),
+                            np.linalg.solve(c, b).real,
+                            rtol=100*rtol, atol=100*rtol)
+            assert_allclose(np.linalg.solve(a[0], b[0, :, 0]),
+                            np.linalg.solve(c[0], b[0, :, 0]).real,
+                            rtol=100*rtol, atol=100*rtol)
+            for uplo, tri in [('L', np.tril), ('U', np.triu)]:
+                w, v = np.linalg.eigh(tri(h), UPLO=uplo)
+                assert_(np.all(np.diff(w, axis=-1) >= 0))
+                assert_allclose(w, np.linalg.eigvalsh(h.astype(np.complex128)),
+                                rtol=rtol, atol=10*rtol)
+                assert_allclose(np.matmul(v * w[..., None, :],
+                                          np.swapaxes(v, -1, -2)),
+                                h, rtol=rtol, atol=10*rtol)
+                assert_allclose(np.matmul(np.swapaxes(v, -1, -2), v),
+                                np.broadcast_to(np.eye(n), v.shape),
+                                rtol=rtol, atol=10*rtol)
+
+    assert_equal(np.linalg.det(np.ones((3, 3))), 0)
+    assert_equal(np.linalg.slogdet(np.zeros((4, 4))), (0, -np.inf))
+    assert_raises(LinAlgError, np.linalg.inv, np.ones((4, 4)))
+    assert_raises(LinAlgError, np.linalg.solve, np.ones((2, 2)), np.ones(2))
+    assert_equal(np.linalg.eigh(np.diag([3., 1., 2.]))[0], [1, 2, 3])
+
+
+def test_small_closed_forms_fp_flags():
+    # entries too large or small for the closed forms go to LAPACK without
+    # leaving floating point flags behind
+    for dtype, big in [(np.float32, 1e30), (np.float64, 1e200)]:
+        with np.errstate(all='raise'):
+            sign, logdet = np.linalg.slogdet(np.diag([big, big]).astype(dtype))
+            assert_equal(sign, 1)
+            assert_allclose(logdet, 2*np.log(big), rtol=1e-6)
+            d = np.linalg.det(np.diag([big, 1/big]).astype(dtype))
+            assert_allclose(d, 1, rtol=1e-6)
+            assert_allclose(np.linalg.inv(np.diag([big, big]).astype(dtype)),
+                            np.diag([1/big, 1/big]), rtol=1e-6)
+
+    # as do large or tiny right hand sides
+    for n in range(1, 5):
+        with np.errstate(all='raise'):
+            for scale, rhs in [(1e10, 1e300), (1e-30, 1e-300)]:
+                x = np.linalg.solve(scale*np.eye(n), np.full(n, rhs))
+                assert_allclose(x, rhs/scale, rtol=1e-12)
+                x = np.linalg.solve(scale*np.eye(n), np.full((n, 2), rhs))
+                assert_allclose(x, rhs/scale, rtol=1e-12)
+
+
+def test_fortran_outputs():
+    # outputs in FORTRAN order are written by LAPACK in place
+    from numpy.linalg import _umath_linalg as umath_linalg
+    rng = np.random.RandomState(1234)
+    for dtype in [np.float64, np.complex64]:
+        a = (rng.randn(3, 6, 6) + 6*np.eye(6)).astype(dtype)
+        b = rng.randn(3, 6, 2).astype(dtype)
+        h = a + np.swapaxes(a, -1, -2).conj()
+        rtol = get_rtol(dtype)
+
+        out = np.empty((3, 6, 6), dtype).transpose(0, 2, 1)
+        umath_linalg.inv(a, out=out)
+        assert_allclose(out, umath_linalg.inv(a), rtol=rtol, atol=rtol)
+
+        out = np.empty((3, 2, 6), dtype).transpose(0, 2, 1)
+        umath_linalg.solve(a, b, out=out)
+        assert_allclose(out, umath_linalg.solve(a, b), rtol=rtol, atol=rtol)
+
+        w = np.empty((3, 6), np.finfo(dtype).dtype)
+        v = np.empty((3, 6, 6), dtype).transpose(0, 2, 1)
+        umath_linalg.eigh_lo(h, out=(w, v))
+        w_c, v_c = umath_linalg.eigh_lo(h)
+        assert_array_equal(w, w_c)
+        assert_array_equal(v, v_c)
+
+        # failures still give nan
+        with np.errstate(invalid='ignore'):
+            out = np.empty((2, 6, 6), dtype).transpose(0, 2, 1)
+            umath_linalg.inv(np.zeros((2, 6, 6), dtype), out=out)
+        assert_(np.isnan(out).all())
+
+
+def test_repeated_shapes():
+    # work size queries and workspace are reused between calls, alternating
+    # shapes must not pick up the sizes of the other one
+    rng = np.random.RandomState(1234)
+    x, y = rng.randn(7, 9), rng.randn(12, 5)
+
+    def results():
+        return (np.linalg.svd(x) + np.linalg.svd(y) +
+                np.linalg.lstsq(x, x[:, :2], rcond=None)[:1] +
+                np.linalg.lstsq(y, y[:, :3], rcond=None)[:1])
+
+    expected = results()
+    for _ in range(3):
+        for r, e in zip(results(), expected):
+            assert_array_equal(r, e)
+
+
 def test_xerbla_override():
     # Check that our xerbla has been successfully linked in. If it is not,
     # the default xerbla routine is called, which prints a message to stdout
@@ -102,7 +102,7 @@ with warnings.catch_warnings():
 ranf = random = sample = random_sample
 __all__.extend(['ranf', 'random', 'sample'])
 
-def __RandomState_ctor():
+def __RandomState_ctor(method='legacy'):
     """Return a RandomState instance.
 
     This function exists solely to assist (un)pickling.
@@ -115,7 +115,7 @@ def __RandomState_ctor():
     See https://github.com/numpy/numpy/issues/4763 for a detailed discussion
 
     """
-    return RandomState(seed=0)
+    return RandomState(seed=0, method=method)
 
 from numpy.testing._private.pytesttester import PytestTester
 test = PytestTester(__name__)
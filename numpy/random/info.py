@@ -14,6 +14,7 @@ permutation          Randomly permute a sequence / generate a random sequence.
 shuffle              Randomly permute a sequence in place.
 seed                 Seed the random number generator.
 choice               Random sample from 1-D array.
+alias_sampler        Repeated weighted draws from 1-D array.
 
 ==================== =========================================================
 
@@ -58,13 +59,17 @@ weibull              Weibull distribution.
 zipf                 Zipf's distribution over ranked data.
 ==================== =========================================================
 
-==================== =========================================================
+=========================== ==================================================
 Multivariate distributions
 ==============================================================================
-dirichlet            Multivariate generalization of Beta distribution.
-multinomial          Multivariate generalization of the binomial distribution.
-multivariate_normal  Multivariate generalization of the normal distribution.
-==================== =========================================================
+dirichlet                   Multivariate generalization of Beta distribution.
+multinomial                 Multivariate generalization of the binomial
+                            distribution.
+multivariate_normal         Multivariate generalization of the normal
+                            distribution.
+multivariate_normal_sampler Repeated draws from a multivariate normal
+                            distribution.
+=========================== ==================================================
 
 ==================== =========================================================
 Standard distributions
@@ -89,6 +94,7 @@ from __future__ import division, absolute_import, print_function
 depends = ['core']
 
 __all__ = [
+    'alias_sampler',
     'beta',
     'binomial',
     'bytes',
@@ -108,6 +114,7 @@ __all__ = [
     'logseries',
     'multinomial',
     'multivariate_normal',
+    'multivariate_normal_sampler',
     'negative_binomial',
     'noncentral_chisquare',
     'noncentral_f',
@@ -42,6 +42,7 @@
  */
 
 #include "distributions.h"
+#include "ziggurat.h"
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
@@ -107,12 +108,104 @@ double rk_normal(rk_state *state, double loc, double scale)
     return loc + scale*rk_gauss(state);
 }
 
+/*
+ * Ziggurat method with 256 layers, taking the layer and a 53 bit abscissa
+ * from one 64 bit draw. The tail beyond ZIG_EXP_R is again exponential.
+ */
+static double rk_standard_exponential_zig(rk_state *state)
+{
+    for (;;)
+    {
+        npy_uint64 r = rk_uint64(state);
+        int idx = r & 0xff;
+        npy_uint64 ri = r >> 11;
+        double x = ri * zig_exp_w[idx];
+
+        if (ri < zig_exp_k[idx])
+        {
+            return x;
+        }
+        if (idx == 0)
+        {
+            return ZIG_EXP_R - log(1.0 - rk_double(state));
+        }
+        if (zig_exp_f[idx] + rk_double(state)*(zig_exp_f[idx - 1] -
+                zig_exp_f[idx]) < exp(-x))
+        {
+            return x;
+        }
+    }
+}
+
 double rk_standard_exponential(rk_state *state)
 {
+    if (state->method == RK_ZIGGURAT)
+    {
+        return rk_standard_exponential_zig(state);
+    }
     /* We use -log(1-U) since U is [0, 1) */
     return -log(1.0 - rk_double(state));
 }
 
+void rk_fill_standard_exponential(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i;
+
+    if (state->method == RK_ZIGGURAT)
+    {
+        for (i = 0; i < cnt; i++)
+        {
+            out[i] = rk_standard_exponential_zig(state);
+        }
+        return;
+    }
+    rk_fill_double(cnt, out, state);
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = -log(1.0 - out[i]);
+    }
+}
+
+/*
+ * The same ziggurat with the layer and a 24 bit abscissa taken from one 32
+ * bit draw, the abscissa scaled to 53 bits for the tables.
+ */
+static float rk_standard_exponential_zig_float(rk_state *state)
+{
+    for (;;)
+    {
+        npy_uint32 r = (npy_uint32)rk_random(state);
+        int idx = r & 0xff;
+        npy_uint64 ri = (npy_uint64)(r >> 8) << 29;
+        double x = ri * zig_exp_w[idx];
+
+        if (ri < zig_exp_k[idx])
+        {
+            return (float)x;
+        }
+        if (idx == 0)
+        {
+            return (float)(ZIG_EXP_R - log(1.0 - rk_double(state)));
+        }
+        if (zig_exp_f[idx] + rk_double(state)*(zig_exp_f[idx - 1] -
+                zig_exp_f[idx]) < exp(-x))
+        {
+            return (float)x;
+        }
+    }
+}
+
+void rk_fill_standard_exponential_float(npy_intp cnt, float *out,
+                                        rk_state *state)
+{
+    npy_intp i;
+
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = rk_standard_exponential_zig_float(state);
+    }
+}
+
 double rk_exponential(rk_state *state, double scale)
 {
     return scale * rk_standard_exponential(state);
@@ -132,6 +225,17 @@ double rk_standard_gamma(rk_state *state, double shape)
     {
         return rk_standard_exponential(state);
     }
+    else if (shape < 1.0 && state->method == RK_ZIGGURAT)
+    {
+        /* Marsaglia and Tsang: G(shape) = G(shape + 1) * U^(1/shape) */
+        if (shape == 0.0)
+        {
+            return 0.0;
+        }
+        U = rk_double(state);
+        return rk_standard_gamma(state, shape + 1.0) *
+               pow(1.0 - U, 1./shape);
+    }
     else if (shape < 1.0)
     {
         for (;;)
@@ -51,9 +51,18 @@ extern "C" {
 extern double rk_normal(rk_state *state, double loc, double scale);
 
 /* Standard exponential distribution (mean=1) computed by inversion of the
- * CDF. */
+ * CDF, or with the ziggurat method if state->method is RK_ZIGGURAT. */
 extern double rk_standard_exponential(rk_state *state);
 
+/* Fill out with cnt standard exponential deviates. */
+extern void rk_fill_standard_exponential(npy_intp cnt, double *out,
+                                         rk_state *state);
+
+/* Fill out with cnt single precision standard exponential deviates, drawn
+ * with the ziggurat method from 32 bit draws whatever state->method. */
+extern void rk_fill_standard_exponential_float(npy_intp cnt, float *out,
+                                               rk_state *state);
+
 /* Exponential distribution with mean=scale. */
 extern double rk_exponential(rk_state *state, double scale);
 
@@ -64,7 +73,8 @@ extern double rk_uniform(rk_state *state, double loc, double scale);
  * When shape < 1, the algorithm given by (Devroye p. 304) is used.
  * When shape == 1, a Exponential variate is generated.
  * When shape > 1, the small and fast method of (Marsaglia and Tsang 2000)
- * is used.
+ * is used. With RK_ZIGGURAT it is also used for shape < 1, through
+ * G(shape) = G(shape + 1) * U^(1/shape).
  */
 extern double rk_standard_gamma(rk_state *state, double shape);
 
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+"""
+Generate mt19937_jump.h, the polynomial used by rk_jump to advance the
+Mersenne Twister by 2**128 draws.
+
+The characteristic polynomial p of the MT19937 recurrence, of degree 19937,
+is found with the Berlekamp-Massey algorithm from the lowest bits of the
+output. Seen as a linear map A on the 624 words of its state, the generator
+also has 31 bits, the lower bits of the oldest word, that never affect later
+words, so that A is annihilated by x*p(x). The jump polynomial is then
+x**(2**128) mod x*p(x), and A**(2**128) s = q(A) s for every state s.
+
+Polynomials over GF(2) are Python integers, bit i holding the coefficient
+of x**i.
+"""
+from __future__ import division, absolute_import, print_function
+
+import random
+
+JUMP_LOG2 = 128
+NWORDS = 624
+
+
+def mt19937_bits(seed, count):
+    """The lowest bits of `count` outputs of the Mersenne Twister."""
+    rng = random.Random(seed)
+    return [rng.getrandbits(32) & 1 for i in range(count)]
+
+
+def berlekamp_massey(bits):
+    """The shortest recurrence generating `bits` as a connection polynomial."""
+    c, b = 1, 1
+    length, m = 0, -1
+    window = 0
+    for n, bit in enumerate(bits):
+        window = (window << 1) | bit
+        if bin(c & window).count('1') & 1:
+            t = c
+            c ^= b << (n - m)
+            if 2*length <= n:
+                length, b, m = n + 1 - length, t, n
+    return c, length
+
+
+def reverse(poly, degree):
+    return int(bin(poly)[2:].zfill(degree + 1)[::-1], 2)
+
+
+def square(poly):
+    # squaring over GF(2) spreads the bits: sum a_i x**(2 i)
+    return int(bin(poly)[2:].replace('', '0')[:-1], 2) if poly else 0
+
+
+def reduce(poly, modulus):
+    degree = modulus.bit_length() - 1
+    while poly.bit_length() > degree:
+        poly ^= modulus << (poly.bit_length() - 1 - degree)
+    return poly
+
+
+def main():
+    conn, degree = berlekamp_massey(mt19937_bits(0, 2*19937 + 100))
+    assert degree == 19937
+    modulus = reverse(conn, degree) << 1
+    q = 2
+    for i in range(JUMP_LOG2):
+        q = reduce(square(q), modulus)
+
+    words = [(q >> (32*i)) & 0xffffffff for i in range(NWORDS)]
+    assert q >> (32*NWORDS) == 0
+    out = ['/*',
+           ' * Coefficients of x**(2**%d) mod x*p(x), p the characteristic'
+           % JUMP_LOG2,
+           ' * polynomial of MT19937, bit j of word i being that of'
+           ' x**(32*i + j).',
+           ' * Generated by generate_mt_jump.py, do not edit.',
+           ' */',
+           '#ifndef _RK_MT19937_JUMP_',
+           '#define _RK_MT19937_JUMP_',
+           '',
+           '#define MT_JUMP_DEGREE %d' % (q.bit_length() - 1),
+           '',
+           'static const npy_uint32 mt_jump_poly[%d] = {' % NWORDS]
+    line = '   '
+    for w in words:
+        item = '0x%08x' % w
+        if len(line) + len(item) + 2 > 79:
+            out.append(line)
+            line = '   '
+        line += ' ' + item + ','
+    out += [line.rstrip(','), '};', '', '#endif']
+    with open('mt19937_jump.h', 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
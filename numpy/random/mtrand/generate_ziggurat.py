@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+"""
+Generate ziggurat.h, the tables of the 256 layer ziggurat samplers for the
+standard normal and standard exponential distributions.
+
+Layer 0 is the base strip, the rectangle [0, r] x [0, f(r)] together with the
+tail beyond r, of area v. Layers 1 to 255 are rectangles of the same area,
+layer i spanning [0, x_i] in x and [f(x_i), f(x_{i-1})] in y with f(x_0) = 1
+and x_255 = r. For layer 0, x_0 is taken as v / f(r) so that the uniform
+draw scaled by it falls in the rectangle with probability r f(r) / v.
+
+The recursion is carried out in 50 digit decimal arithmetic and the results
+rounded to double precision.
+"""
+from __future__ import division, absolute_import, print_function
+
+import math
+from decimal import Decimal, getcontext
+
+getcontext().prec = 50
+
+NLAYERS = 256
+
+
+def layers(f, finv, r, v):
+    x = [None]*NLAYERS
+    x[NLAYERS - 1] = r
+    for i in range(NLAYERS - 2, 0, -1):
+        x[i] = finv(v/x[i + 1] + f(x[i + 1]))
+    x[0] = v/f(r)
+    return x
+
+
+def tables(name, f, finv, r, v, bits):
+    x = layers(f, finv, r, v)
+    scale = Decimal(2)**bits
+    k = [int(r/x[0]*scale), 0]
+    k += [int(x[i - 1]/x[i]*scale) for i in range(2, NLAYERS)]
+    w = [xi/scale for xi in x]
+    fx = [Decimal(1)] + [f(xi) for xi in x[1:]]
+
+    out = []
+    for suffix, ctype, values, conv in [
+            ('k', 'npy_uint64', k, lambda val: '0x%xULL' % val),
+            ('w', 'double', w, lambda val: repr(float(val))),
+            ('f', 'double', fx, lambda val: repr(float(val)))]:
+        out.append('static const %s %s_%s[%d] = {' % (ctype, name, suffix,
+                                                      NLAYERS))
+        line = '   '
+        for val in values:
+            item = conv(val)
+            if len(line) + len(item) + 2 > 79:
+                out.append(line)
+                line = '   '
+            line += ' ' + item + ','
+        out += [line.rstrip(','), '};', '']
+    return out
+
+
+def main():
+    rn = Decimal('3.6541528853610088')
+    tail = math.sqrt(math.pi/2)*math.erfc(float(rn)/math.sqrt(2))
+    vn = rn*(-rn*rn/2).exp() + Decimal(repr(tail))
+    re = Decimal('7.69711747013104972')
+    ve = (re + 1)*(-re).exp()
+
+    out = ['/*',
+           ' * Tables of the 256 layer ziggurat samplers of the standard '
+           'normal and',
+           ' * standard exponential distributions, see rk_gauss_zig and',
+           ' * rk_standard_exponential_zig. Generated by generate_ziggurat.py,'
+           ' do not',
+           ' * edit.',
+           ' */',
+           '#ifndef _RK_ZIGGURAT_',
+           '#define _RK_ZIGGURAT_',
+           '',
+           '#define ZIG_NOR_R %r' % float(rn),
+           '#define ZIG_EXP_R %r' % float(re),
+           '']
+    out += tables('zig_nor', lambda x: (-x*x/2).exp(),
+                  lambda y: (-2*y.ln()).sqrt(), rn, vn, 52)
+    out += tables('zig_exp', lambda x: (-x).exp(), lambda y: -y.ln(),
+                  re, ve, 53)
+    out += ['#endif']
+    with open('ziggurat.h', 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -149,4 +149,5 @@ init_by_array(rk_state *self, unsigned long init_key[], npy_intp key_length)
     self->gauss = 0;
     self->has_gauss = 0;
     self->has_binomial = 0;
+    rk_seed_brng(self);
 }
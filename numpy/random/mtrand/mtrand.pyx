@@ -43,11 +43,27 @@ cdef extern from "mtrand_py_helper.h":
 
 cdef extern from "randomkit.h":
 
+    ctypedef enum rk_method:
+        RK_LEGACY = 0
+        RK_ZIGGURAT = 1
+
+    ctypedef enum rk_brng:
+        RK_MT19937 = 0
+        RK_PCG64 = 1
+        RK_PHILOX = 2
+        RK_XOSHIRO256 = 3
+
     ctypedef struct rk_state:
         unsigned long key[624]
         int pos
         int has_gauss
         double gauss
+        rk_method method
+        rk_brng brng
+        npy_uint64 bstate[10]
+        int bpos
+        int has_uint32
+        npy_uint32 uinteger
 
     ctypedef enum rk_error:
         RK_NOERR = 0
@@ -61,6 +77,7 @@ cdef extern from "randomkit.h":
 
     void rk_seed(unsigned long seed, rk_state *state)
     rk_error rk_randomseed(rk_state *state)
+    void rk_jump(rk_state *state) nogil
     unsigned long rk_random(rk_state *state)
     long rk_long(rk_state *state) nogil
     unsigned long rk_ulong(rk_state *state) nogil
@@ -71,6 +88,10 @@ cdef extern from "randomkit.h":
     rk_error rk_altfill(void *buffer, size_t size, int strong,
             rk_state *state) nogil
     double rk_gauss(rk_state *state) nogil
+    void rk_fill_double(npy_intp cnt, double *out, rk_state *state) nogil
+    void rk_fill_gauss(npy_intp cnt, double *out, rk_state *state) nogil
+    void rk_fill_float(npy_intp cnt, float *out, rk_state *state) nogil
+    void rk_fill_gauss_float(npy_intp cnt, float *out, rk_state *state) nogil
     void rk_random_uint64(npy_uint64 off, npy_uint64 rng, npy_intp cnt,
                           npy_uint64 *out, rk_state *state) nogil
     void rk_random_uint32(npy_uint32 off, npy_uint32 rng, npy_intp cnt,
@@ -88,6 +109,10 @@ cdef extern from "distributions.h":
 
     double rk_normal(rk_state *state, double loc, double scale) nogil
     double rk_standard_exponential(rk_state *state) nogil
+    void rk_fill_standard_exponential(npy_intp cnt, double *out,
+                                      rk_state *state) nogil
+    void rk_fill_standard_exponential_float(npy_intp cnt, float *out,
+                                            rk_state *state) nogil
     double rk_exponential(rk_state *state, double scale) nogil
     double rk_uniform(rk_state *state, double loc, double scale) nogil
     double rk_standard_gamma(rk_state *state, double shape) nogil
@@ -127,6 +152,8 @@ ctypedef double (* rk_cont0)(rk_state *state) nogil
 ctypedef double (* rk_cont1)(rk_state *state, double a) nogil
 ctypedef double (* rk_cont2)(rk_state *state, double a, double b) nogil
 ctypedef double (* rk_cont3)(rk_state *state, double a, double b, double c) nogil
+ctypedef void (* rk_fill0)(npy_intp cnt, double *out, rk_state *state) nogil
+ctypedef void (* rk_fill0f)(npy_intp cnt, float *out, rk_state *state) nogil
 
 ctypedef long (* rk_disc0)(rk_state *state) nogil
 ctypedef long (* rk_discnp)(rk_state *state, long n, double p) nogil
@@ -137,7 +164,7 @@ ctypedef long (* rk_discd)(rk_state *state, double a) nogil
 
 cdef extern from "initarray.h":
    void init_by_array(rk_state *self, unsigned long *init_key,
-                      npy_intp key_length)
+                      npy_intp key_length) nogil
 
 # Initialize numpy
 import_array()
@@ -148,9 +175,14 @@ import operator
 import warnings
 
 try:
-    from threading import Lock
+    from threading import Lock, Thread
 except ImportError:
-    from dummy_threading import Lock
+    from dummy_threading import Lock, Thread
+
+_methods = {'legacy': RK_LEGACY, 'ziggurat': RK_ZIGGURAT}
+# bit generator name: (rk_brng, number of 64 bit state words)
+_bit_generators = {'MT19937': (RK_MT19937, 0), 'PCG64': (RK_PCG64, 4),
+                   'Philox': (RK_PHILOX, 10), 'Xoshiro256': (RK_XOSHIRO256, 4)}
 
 cdef object cont0_array(rk_state *state, rk_cont0 func, object size,
                         object lock):
@@ -173,6 +205,164 @@ cdef object cont0_array(rk_state *state, rk_cont0 func, object size,
         return array
 
 
+# Number of values drawn from each substream by the parallel fills. The
+# values depend on it, so it must not change.
+cdef npy_intp _fill_chunk = 65536
+
+
+cdef void _fill_chunks(rk_state *state, rk_fill0 fill, rk_fill0f fill_float,
+                       void *out, npy_intp length, unsigned long *key,
+                       npy_intp first, npy_intp step) nogil:
+    # fill chunks first, first + step, ... of out, seeding state from the
+    # first 8 words of key and the chunk number. out holds doubles if fill
+    # is given, floats otherwise.
+    cdef npy_intp k = first, start, n
+    while k*_fill_chunk < length:
+        start = k*_fill_chunk
+        n = min(length - start, _fill_chunk)
+        key[8] = k & 0xffffffffUL
+        key[9] = (k >> 16) >> 16
+        init_by_array(state, key, 10)
+        if fill != NULL:
+            fill(n, <double *>out + start, state)
+        else:
+            fill_float(n, <float *>out + start, state)
+        k += step
+
+
+cdef class _ChunkFiller:
+    # The work of one thread of parallel_fill
+    cdef rk_state state
+    cdef unsigned long key[10]
+    cdef rk_fill0 fill
+    cdef rk_fill0f fill_float
+    cdef void *out
+    cdef npy_intp length, first, step
+
+    def run(self):
+        with nogil:
+            _fill_chunks(&self.state, self.fill, self.fill_float, self.out,
+                         self.length, self.key, self.first, self.step)
+
+
+cdef parallel_fill(rk_state *state, rk_fill0 fill, rk_fill0f fill_float,
+                   void *out, npy_intp length, object threads, object lock):
+    """
+    Fill out in chunks of _fill_chunk values, each from a substream of the
+    bit generator of state seeded with init_by_array from 8 words drawn from
+    state and the number of the chunk. The values are the same for any
+    number of threads. Seeding is used rather than rk_jump as the MT19937
+    jump costs milliseconds. out holds doubles drawn by fill, or if it is
+    NULL floats drawn by fill_float.
+    """
+    cdef unsigned long key[8]
+    cdef _ChunkFiller filler
+    cdef npy_intp i, nchunks, nthreads = operator.index(threads)
+
+    if nthreads < 1:
+        raise ValueError("threads must be positive")
+    with lock:
+        for i in range(8):
+            key[i] = rk_random(state)
+    nchunks = (length + _fill_chunk - 1) // _fill_chunk
+    nthreads = max(min(nthreads, nchunks), 1)
+
+    fillers = []
+    for i in range(nthreads):
+        filler = _ChunkFiller()
+        filler.state.method = state.method
+        filler.state.brng = state.brng
+        string.memcpy(filler.key, key, sizeof(key))
+        filler.fill = fill
+        filler.fill_float = fill_float
+        filler.out = out
+        filler.length = length
+        filler.first = i
+        filler.step = nthreads
+        fillers.append(filler)
+    workers = [Thread(target=f.run) for f in fillers[1:]]
+    for w in workers:
+        w.start()
+    fillers[0].run()
+    for w in workers:
+        w.join()
+
+
+cdef object cont0_fill_array(rk_state *state, rk_cont0 func, rk_fill0 fill,
+                             object size, object lock, object threads=None):
+    # cont0_array, filling arrays with one call of fill, or in parallel if
+    # threads is given
+    cdef double *array_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+
+    if threads is not None:
+        array = <ndarray>np.empty(1 if size is None else size, np.float64)
+        array_data = <double *>PyArray_DATA(array)
+        parallel_fill(state, fill, NULL, array_data, PyArray_SIZE(array),
+                      threads, lock)
+        return array_data[0] if size is None else array
+
+    if size is None:
+        with lock, nogil:
+            rv = func(state)
+        return rv
+    else:
+        array = <ndarray>np.empty(size, np.float64)
+        length = PyArray_SIZE(array)
+        array_data = <double *>PyArray_DATA(array)
+        with lock, nogil:
+            fill(length, array_data, state)
+        return array
+
+
+cdef object cont0_float_array(rk_state *state, rk_fill0f fill, object size,
+                              object lock, object threads=None):
+    # cont0_fill_array in single precision, returning a float32 array, or
+    # scalar if size is None
+    cdef float *array_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+
+    array = <ndarray>np.empty(1 if size is None else size, np.float32)
+    length = PyArray_SIZE(array)
+    array_data = <float *>PyArray_DATA(array)
+    if threads is None:
+        with lock, nogil:
+            fill(length, array_data, state)
+    else:
+        parallel_fill(state, NULL, fill, array_data, length, threads, lock)
+    return array[0] if size is None else array
+
+
+def _is_float32(dtype, name):
+    # whether the values of the method name are drawn in single precision
+    key = np.dtype(dtype)
+    if key == np.float32:
+        return True
+    if key == np.float64:
+        return False
+    raise TypeError('Unsupported dtype "%s" for %s' % (key, name))
+
+
+def _float32_below_high(out, low, high):
+    # single precision samples of [low, high) can round onto or past high;
+    # move those to the closest float32 inside the interval
+    low = np.asarray(low, np.float64)
+    high = np.asarray(high, np.float64)
+    high32 = high.astype(np.float32)
+    past = (high32 - high)*(high - low) >= 0
+    lim = np.where(past, np.nextafter(high32, low.astype(np.float32)), high32)
+    if lim.ndim == 0:
+        if high > low:
+            np.minimum(out, lim, out=out)
+        elif high < low:
+            np.maximum(out, lim, out=out)
+    else:
+        np.copyto(out, lim, where=(out - lim)*(high - low) > 0)
+    return out
+
+
 cdef object cont1_array_sc(rk_state *state, rk_cont1 func, object size, double a,
                            object lock):
     cdef double *array_data
@@ -248,6 +438,36 @@ cdef object cont2_array_sc(rk_state *state, rk_cont2 func, object size, double a
         return array
 
 
+cdef object cont2_fill_array_sc(rk_state *state, rk_cont2 func, rk_fill0 fill,
+                                object size, double a, double b,
+                                object lock, object threads=None):
+    # cont2_array_sc for func(state, a, b) == a + b*draw, the draws
+    # made by fill, or in parallel if threads is given
+    cdef double *array_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+    cdef npy_intp i
+
+    if size is None and threads is None:
+        with lock, nogil:
+            rv = func(state, a, b)
+        return rv
+    else:
+        array = <ndarray>np.empty(1 if size is None else size, np.float64)
+        length = PyArray_SIZE(array)
+        array_data = <double *>PyArray_DATA(array)
+        if threads is None:
+            with lock, nogil:
+                fill(length, array_data, state)
+        else:
+            parallel_fill(state, fill, NULL, array_data, length, threads,
+                          lock)
+        with nogil:
+            for i from 0 <= i < length:
+                array_data[i] = a + b*array_data[i]
+        return array_data[0] if size is None else array
+
+
 cdef object cont2_array(rk_state *state, rk_cont2 func, object size,
                         ndarray oa, ndarray ob, object lock):
     cdef double *array_data
@@ -563,6 +783,114 @@ cdef double kahan_sum(double *darr, npy_intp n):
         sum = t
     return sum
 
+def _population(a):
+    # a as an array and the size of the population it stands for, see choice
+    a = np.array(a, copy=False)
+    if a.ndim == 0:
+        try:
+            # __index__ must return an integer by python rules.
+            pop_size = operator.index(a.item())
+        except TypeError:
+            raise ValueError("a must be 1-dimensional or an integer")
+        if pop_size <= 0:
+            raise ValueError("a must be greater than 0")
+    elif a.ndim != 1:
+        raise ValueError("a must be 1-dimensional")
+    else:
+        pop_size = a.shape[0]
+        if pop_size is 0:
+            raise ValueError("a must be non-empty")
+    return a, pop_size
+
+cdef ndarray _probabilities(object p, npy_intp pop_size):
+    # p as a double array, checked to be a probability vector of pop_size
+    # entries
+    cdef double *pix
+    d = len(p)
+
+    atol = np.sqrt(np.finfo(np.float64).eps)
+    if isinstance(p, np.ndarray):
+        if np.issubdtype(p.dtype, np.floating):
+            atol = max(atol, np.sqrt(np.finfo(p.dtype).eps))
+
+    p = <ndarray>PyArray_ContiguousFromObject(p, NPY_DOUBLE, 1, 1)
+    pix = <double*>PyArray_DATA(p)
+
+    if p.ndim != 1:
+        raise ValueError("p must be 1-dimensional")
+    if p.size != pop_size:
+        raise ValueError("a and p must have same size")
+    if np.logical_or.reduce(p < 0):
+        raise ValueError("probabilities are not non-negative")
+    if abs(kahan_sum(pix, d) - 1.) > atol:
+        raise ValueError("probabilities do not sum to 1")
+    return p
+
+cdef inline bint _set_insert(npy_intp *table, npy_intp mask, int shift,
+                             npy_intp v) nogil:
+    # add v to the open addressing hash set table of mask + 1 entries,
+    # False if it is present already
+    cdef npy_intp h = <npy_intp>((<npy_uint64>v * 0x9E3779B97F4A7C15ULL)
+                                 >> shift)
+    while table[h] != -1:
+        if table[h] == v:
+            return False
+        h = (h + 1) & mask
+    table[h] = v
+    return True
+
+cdef ndarray _sample_indices(rk_state *state, npy_intp n, npy_intp k,
+                             object lock):
+    """
+    k distinct integers of range(n) in random order, with O(k) draws. Uses
+    Floyd's algorithm with a hash set of the values drawn when n is much
+    larger than k, then shuffles them, and a partial Fisher-Yates shuffle of
+    range(n) otherwise.
+    """
+    cdef ndarray out "arrayObject_out"
+    cdef ndarray table "arrayObject_table"
+    cdef npy_intp *out_data
+    cdef npy_intp *table_data
+    cdef npy_intp i, j, t, size
+    cdef int shift
+
+    if n < 16*k:
+        out = <ndarray>np.arange(n, dtype=np.intp)
+        out_data = <npy_intp *>PyArray_DATA(out)
+        with lock, nogil:
+            for i in range(k):
+                j = i + rk_interval(n - 1 - i, state)
+                t = out_data[i]
+                out_data[i] = out_data[j]
+                out_data[j] = t
+        return out[:k].copy()
+
+    # table of at least 2*k entries
+    shift = 64
+    size = 1
+    while size < 2*k:
+        size *= 2
+        shift -= 1
+    table = <ndarray>np.full(size, -1, dtype=np.intp)
+    table_data = <npy_intp *>PyArray_DATA(table)
+    out = <ndarray>np.empty(k, dtype=np.intp)
+    out_data = <npy_intp *>PyArray_DATA(out)
+    with lock, nogil:
+        for i in range(k):
+            j = n - k + i
+            t = rk_interval(j, state)
+            if not _set_insert(table_data, size - 1, shift, t):
+                t = j
+                _set_insert(table_data, size - 1, shift, t)
+            out_data[i] = t
+        # Floyd's subsets are uniform but their order is not
+        for i in reversed(range(1, k)):
+            j = rk_interval(i, state)
+            t = out_data[i]
+            out_data[i] = out_data[j]
+            out_data[j] = t
+    return out
+
 def _shape_from_size(size, d):
     if size is None:
         shape = (d,)
@@ -573,6 +901,57 @@ def _shape_from_size(size, d):
            shape = tuple(size) + (d,)
     return shape
 
+def _mvn_factor(cov, method, check_valid, tol):
+    # Compute A such that dot(transpose(A),A) == cov. Then the matrix
+    # products of rows of independent standard normals and A have the
+    # desired covariance. The factor is the transposed Cholesky factor, or
+    # sqrt(s)*v for the eigendecomposition or singular value decomposition
+    # (u,s,v) of cov. The Cholesky factorization fails for singular
+    # covariances, which then fall back on eigh.
+    #
+    # Also check that cov is symmetric positive-semidefinite: the factor
+    # must reproduce cov up to roundoff error.
+    from numpy.dual import cholesky, eigh, svd
+    from numpy.linalg import LinAlgError
+
+    if check_valid not in ('warn', 'raise', 'ignore'):
+        raise ValueError("check_valid must equal 'warn', 'raise', or 'ignore'")
+    if method not in ('cholesky', 'eigh', 'svd'):
+        raise ValueError("method must equal 'cholesky', 'eigh', or 'svd'")
+
+    if method == 'cholesky':
+        try:
+            A = cholesky(cov).T
+        except LinAlgError:
+            method = 'eigh'
+    if method == 'eigh':
+        (s, v) = eigh(cov)
+        v = v.T
+        s = np.maximum(s, 0)
+        A = np.sqrt(s)[:, None] * v
+    elif method == 'svd':
+        # If cov is symmetric positive-semidefinite, the u.T and v matrices
+        # are equal up to roundoff error wherever the singular value is
+        # not zero.
+        (u, s, v) = svd(cov)
+        A = np.sqrt(s)[:, None] * v
+
+    if check_valid == 'ignore':
+        return A
+    if method == 'cholesky':
+        psd = np.allclose(np.dot(A.T, A), cov, rtol=tol, atol=tol)
+    else:
+        psd = np.allclose(np.dot(v.T * s, v), cov, rtol=tol, atol=tol)
+    if not psd:
+        if check_valid == 'warn':
+            warnings.warn(
+                "covariance is not symmetric positive-semidefinite.",
+                RuntimeWarning)
+        else:
+            raise ValueError(
+                "covariance is not symmetric positive-semidefinite.")
+    return A
+
 # Look up table for randint functions keyed by type name. The stored data
 # is a tuple (lbnd, ubnd, func), where lbnd is the smallest value for the
 # type, ubnd is one greater than the largest value, and func is the
@@ -592,9 +971,10 @@ _randint_type = {
 
 cdef class RandomState:
     """
-    RandomState(seed=None)
+    RandomState(seed=None, method='legacy', bit_generator='MT19937')
 
-    Container for the Mersenne Twister pseudo-random number generator.
+    Container for a pseudo-random number generator, by default the Mersenne
+    Twister.
 
     `RandomState` exposes a number of methods for generating random numbers
     drawn from a variety of probability distributions. In addition to the
@@ -622,6 +1002,30 @@ cdef class RandomState:
         ``None``, then `RandomState` will try to read data from
         ``/dev/urandom`` (or the Windows analogue) if available or seed from
         the clock otherwise.
+    method : {'legacy', 'ziggurat'}, optional
+        Algorithm used for normal and exponential variates, and thereby for
+        the gamma distribution and the many others built on these three.
+        ``'legacy'`` (the default) uses the polar Box-Muller method and
+        inversion, and reproduces the streams of earlier releases.
+        ``'ziggurat'`` uses the considerably faster ziggurat method of
+        Marsaglia and Tsang, and their method for gamma variates with shape
+        below one. The two give different streams for the same seed; the
+        uniform and integer distributions are not affected.
+
+        .. versionadded:: 1.15.0
+    bit_generator : {'MT19937', 'PCG64', 'Philox', 'Xoshiro256'}, optional
+        The source of random bits all distributions draw from. ``'MT19937'``
+        (the default) is the Mersenne Twister of earlier releases. The others
+        are faster and have much smaller states: ``'PCG64'`` is O'Neill's
+        128 bit permuted congruential generator, ``'Philox'`` the
+        Philox4x64-10 counter based generator of Salmon et al. and
+        ``'Xoshiro256'`` is xoshiro256** of Blackman and Vigna. Their states
+        are initialized from the Mersenne Twister seeded with `seed`, and
+        they draw doubles from a single 64 bit output and bounded integers
+        with Lemire's multiplication method instead of masked rejection, so
+        that their streams are unrelated to those of ``'MT19937'``.
+
+        .. versionadded:: 1.15.0
 
     Notes
     -----
@@ -637,10 +1041,18 @@ cdef class RandomState:
     cdef object state_address
     poisson_lam_max = np.iinfo('l').max - np.sqrt(np.iinfo('l').max)*10
 
-    def __init__(self, seed=None):
+    def __init__(self, seed=None, method='legacy', bit_generator='MT19937'):
+        if method not in _methods:
+            raise ValueError("method must be one of %s"
+                             % ', '.join(repr(m) for m in _methods))
+        if bit_generator not in _bit_generators:
+            raise ValueError("bit_generator must be one of %s"
+                             % ', '.join(repr(b) for b in _bit_generators))
         self.internal_state = <rk_state*>PyMem_Malloc(sizeof(rk_state))
         self.state_address = PyCapsule_New(self.internal_state, NULL, NULL)
         self.lock = Lock()
+        self.internal_state.method = _methods[method]
+        self.internal_state.brng = _bit_generators[bit_generator][0]
         self.seed(seed)
 
     def __dealloc__(self):
@@ -713,6 +1125,12 @@ cdef class RandomState:
             4. an integer ``has_gauss``.
             5. a float ``cached_gaussian``.
 
+            For the other bit generators, the tuple holds their name, a 1-D
+            array of their 64 bit state words, the buffer position ``pos``,
+            ``has_gauss`` and ``cached_gaussian``, and finally the integers
+            ``has_uint32`` and ``uinteger`` keeping the unused half of a 64
+            bit draw.
+
         See Also
         --------
         set_state
@@ -725,6 +1143,21 @@ cdef class RandomState:
 
         """
         cdef ndarray state "arrayObject_state"
+        cdef npy_intp nwords
+        name = self.bit_generator
+        if name != 'MT19937':
+            nwords = _bit_generators[name][1]
+            state = <ndarray>np.empty(nwords, np.uint64)
+            with self.lock:
+                memcpy(<void*>PyArray_DATA(state),
+                       <void*>(self.internal_state.bstate),
+                       nwords*sizeof(npy_uint64))
+                pos = self.internal_state.bpos
+                has_gauss = self.internal_state.has_gauss
+                gauss = self.internal_state.gauss
+                has_uint32 = self.internal_state.has_uint32
+                uinteger = self.internal_state.uinteger
+            return (name, state, pos, has_gauss, gauss, has_uint32, uinteger)
         state = <ndarray>np.empty(624, np.uint)
         with self.lock:
             memcpy(<void*>PyArray_DATA(state), <void*>(self.internal_state.key), 624*sizeof(long))
@@ -754,6 +1187,9 @@ cdef class RandomState:
             4. an integer ``has_gauss``.
             5. a float ``cached_gaussian``.
 
+            The states returned by `get_state` for the other bit generators
+            are accepted too; setting one switches the generator in use.
+
         Returns
         -------
         out : None
@@ -783,9 +1219,33 @@ cdef class RandomState:
         """
         cdef ndarray obj "arrayObject_obj"
         cdef int pos
+        cdef npy_intp nwords
         algorithm_name = state[0]
+        if algorithm_name not in _bit_generators:
+            raise ValueError("algorithm must be one of %s"
+                             % ', '.join(repr(b) for b in _bit_generators))
         if algorithm_name != 'MT19937':
-            raise ValueError("algorithm must be 'MT19937'")
+            if len(state) != 7:
+                raise ValueError("state must be a 7-tuple for %r"
+                                 % algorithm_name)
+            brng, nwords = _bit_generators[algorithm_name]
+            key, pos, has_gauss, cached_gaussian, has_uint32, uinteger = \
+                state[1:]
+            obj = <ndarray>PyArray_ContiguousFromObject(key, NPY_ULONGLONG, 1, 1)
+            if PyArray_DIM(obj, 0) != nwords:
+                raise ValueError("state must be %d 64 bit words" % nwords)
+            if not 0 <= pos <= 4:
+                raise ValueError("pos must be between 0 and 4")
+            with self.lock:
+                memcpy(<void*>(self.internal_state.bstate),
+                       <void*>PyArray_DATA(obj), nwords*sizeof(npy_uint64))
+                self.internal_state.brng = brng
+                self.internal_state.bpos = pos
+                self.internal_state.has_gauss = has_gauss
+                self.internal_state.gauss = cached_gaussian
+                self.internal_state.has_uint32 = has_uint32
+                self.internal_state.uinteger = uinteger
+            return
         key, pos = state[1:3]
         if len(state) == 3:
             has_gauss = 0
@@ -801,10 +1261,119 @@ cdef class RandomState:
             raise ValueError("state must be 624 longs")
         with self.lock:
             memcpy(<void*>(self.internal_state.key), <void*>PyArray_DATA(obj), 624*sizeof(long))
+            self.internal_state.brng = RK_MT19937
             self.internal_state.pos = pos
             self.internal_state.has_gauss = has_gauss
             self.internal_state.gauss = cached_gaussian
 
+    def jump(self, jumps=1):
+        """
+        jump(jumps=1)
+
+        Advance the generator as if a huge number of values had been drawn.
+
+        Each jump moves the bit generator by 2**128 draws for 'MT19937' and
+        'Xoshiro256', by 2**128 blocks of four draws for 'Philox' and by
+        about 2**127.3 draws for 'PCG64', so that the streams before and
+        after a jump do not overlap in practice. Values cached from the
+        previous draws are discarded. The 'MT19937' jump is computed with
+        the jump polynomial of Haramoto et al. and takes a few milliseconds.
+
+        Parameters
+        ----------
+        jumps : int, optional
+            Number of jumps to make, default one.
+
+        See Also
+        --------
+        spawn
+
+        Notes
+        -----
+        .. versionadded:: 1.15.0
+
+        References
+        ----------
+        .. [1] H. Haramoto, M. Matsumoto, T. Nishimura, F. Panneton and
+           P. L'Ecuyer, "Efficient Jump Ahead for F2-Linear Random Number
+           Generators", INFORMS Journal on Computing, Vol. 20, No. 3,
+           pp. 385-390, 2008.
+
+        """
+        cdef npy_intp i, n = operator.index(jumps)
+        if n < 0:
+            raise ValueError("jumps must be non-negative")
+        with self.lock, nogil:
+            for i in range(n):
+                rk_jump(self.internal_state)
+
+    def spawn(self, n):
+        """
+        spawn(n)
+
+        Return `n` independent generators for parallel use.
+
+        The returned generators use the same bit generator and `method` as
+        this one. The first starts at the current state, and each following
+        one a `jump` further, after which this generator is advanced past
+        the last of them. The streams therefore do not overlap, unlike those
+        of generators seeded with consecutive integers, and the result is
+        reproducible from the seed.
+
+        Parameters
+        ----------
+        n : int
+            Number of generators.
+
+        Returns
+        -------
+        out : list of RandomState
+
+        See Also
+        --------
+        jump
+
+        Notes
+        -----
+        .. versionadded:: 1.15.0
+
+        Examples
+        --------
+        >>> streams = np.random.RandomState(12345).spawn(4)
+        >>> samples = [rs.standard_normal(10) for rs in streams]
+
+        """
+        n = operator.index(n)
+        if n < 0:
+            raise ValueError("n must be non-negative")
+        children = []
+        for i in range(n):
+            child = RandomState(0, method=self.method,
+                                bit_generator=self.bit_generator)
+            child.set_state(self.get_state())
+            children.append(child)
+            self.jump()
+        return children
+
+    property method:
+        """
+        The algorithm used for normal and exponential variates, see
+        `RandomState`.
+        """
+        def __get__(self):
+            if self.internal_state.method == RK_ZIGGURAT:
+                return 'ziggurat'
+            return 'legacy'
+
+    property bit_generator:
+        """
+        The name of the bit generator, see `RandomState`.
+        """
+        def __get__(self):
+            for name, (brng, nwords) in _bit_generators.items():
+                if brng == self.internal_state.brng:
+                    return name
+
     # Pickling support:
     def __getstate__(self):
         return self.get_state()
@@ -813,12 +1382,16 @@ cdef class RandomState:
         self.set_state(state)
 
     def __reduce__(self):
-        return (np.random.__RandomState_ctor, (), self.get_state())
+        if self.internal_state.method == RK_LEGACY:
+            # readable by earlier releases
+            return (np.random.__RandomState_ctor, (), self.get_state())
+        return (np.random.__RandomState_ctor, (self.method,),
+                self.get_state())
 
     # Basic distributions:
-    def random_sample(self, size=None):
+    def random_sample(self, size=None, threads=None, dtype=np.float64):
         """
-        random_sample(size=None)
+        random_sample(size=None, threads=None, dtype=np.float64)
 
         Return random floats in the half-open interval [0.0, 1.0).
 
@@ -834,6 +1407,19 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        threads : int, optional
+            Generate the values with this many threads. The output is then
+            drawn in chunks, each from its own substream derived from the
+            state, and is the same for any number of threads but differs
+            from that without `threads`. Default is None, a single stream.
+
+            .. versionadded:: 1.15.0
+        dtype : {float64, float32}, optional
+            Desired dtype of the result. float32 values are drawn from single 32
+            bit outputs of the generator, with 24 bit mantissas, and differ
+            from the float64 values. Default is float64.
+
+            .. versionadded:: 1.15.0
 
         Returns
         -------
@@ -858,7 +1444,11 @@ cdef class RandomState:
                [-1.23204345, -1.75224494]])
 
         """
-        return cont0_array(self.internal_state, rk_double, size, self.lock)
+        if _is_float32(dtype, 'random_sample'):
+            return cont0_float_array(self.internal_state, rk_fill_float, size,
+                                     self.lock, threads)
+        return cont0_fill_array(self.internal_state, rk_double,
+                                rk_fill_double, size, self.lock, threads)
 
     def tomaxint(self, size=None):
         """
@@ -1030,9 +1620,9 @@ cdef class RandomState:
         return bytestring
 
 
-    def choice(self, a, size=None, replace=True, p=None):
+    def choice(self, a, size=None, replace=True, p=None, method=None):
         """
-        choice(a, size=None, replace=True, p=None)
+        choice(a, size=None, replace=True, p=None, method=None)
 
         Generates a random sample from a given 1-D array
 
@@ -1053,6 +1643,17 @@ cdef class RandomState:
             The probabilities associated with each entry in a.
             If not given the sample assumes a uniform distribution over all
             entries in a.
+        method : {None, 'permutation', 'floyd'}, optional
+            How a uniform sample without replacement is drawn. 'permutation'
+            takes the first entries of a random permutation of the whole
+            population, in O(len(a)) time and memory. 'floyd' uses Floyd's
+            algorithm, in O(size) time and memory, so that the population may
+            be huge. The two give different samples for the same seed. The
+            default is 'permutation' for the MT19937 bit generator, which
+            keeps the stream of earlier releases, and 'floyd' for the others.
+            Ignored when `replace` is True or `p` is given.
+
+            .. versionadded:: 1.15.0
 
         Returns
         --------
@@ -1064,9 +1665,9 @@ cdef class RandomState:
         ValueError
             If a is an int and less than zero, if a or p are not 1-dimensional,
             if a is an array-like of size 0, if p is not a vector of
-            probabilities, if a and p have different lengths, or if
+            probabilities, if a and p have different lengths, if
             replace=False and the sample size is greater than the population
-            size
+            size, or if method is not one of the above
 
         See Also
         ---------
@@ -1109,41 +1710,11 @@ cdef class RandomState:
         """
 
         # Format and Verify input
-        a = np.array(a, copy=False)
-        if a.ndim == 0:
-            try:
-                # __index__ must return an integer by python rules.
-                pop_size = operator.index(a.item())
-            except TypeError:
-                raise ValueError("a must be 1-dimensional or an integer")
-            if pop_size <= 0:
-                raise ValueError("a must be greater than 0")
-        elif a.ndim != 1:
-            raise ValueError("a must be 1-dimensional")
-        else:
-            pop_size = a.shape[0]
-            if pop_size is 0:
-                raise ValueError("a must be non-empty")
-
+        a, pop_size = _population(a)
         if p is not None:
-            d = len(p)
-
-            atol = np.sqrt(np.finfo(np.float64).eps)
-            if isinstance(p, np.ndarray):
-                if np.issubdtype(p.dtype, np.floating):
-                    atol = max(atol, np.sqrt(np.finfo(p.dtype).eps))
-
-            p = <ndarray>PyArray_ContiguousFromObject(p, NPY_DOUBLE, 1, 1)
-            pix = <double*>PyArray_DATA(p)
-
-            if p.ndim != 1:
-                raise ValueError("p must be 1-dimensional")
-            if p.size != pop_size:
-                raise ValueError("a and p must have same size")
-            if np.logical_or.reduce(p < 0):
-                raise ValueError("probabilities are not non-negative")
-            if abs(kahan_sum(pix, d) - 1.) > atol:
-                raise ValueError("probabilities do not sum to 1")
+            p = _probabilities(p, pop_size)
+        if method not in (None, 'permutation', 'floyd'):
+            raise ValueError("method must be None, 'permutation' or 'floyd'")
 
         shape = size
         if shape is not None:
@@ -1187,7 +1758,17 @@ cdef class RandomState:
                     n_uniq += new.size
                 idx = found
             else:
-                idx = self.permutation(pop_size)[:size]
+                if method is None:
+                    # MT19937 keeps the streams of earlier releases
+                    if self.internal_state.brng == RK_MT19937:
+                        method = 'permutation'
+                    else:
+                        method = 'floyd'
+                if method == 'permutation':
+                    idx = self.permutation(pop_size)[:size]
+                else:
+                    idx = _sample_indices(self.internal_state, pop_size,
+                                          size, self.lock)
                 if shape is not None:
                     idx.shape = shape
 
@@ -1212,9 +1793,10 @@ cdef class RandomState:
         return a[idx]
 
 
-    def uniform(self, low=0.0, high=1.0, size=None):
+    def uniform(self, low=0.0, high=1.0, size=None, threads=None,
+                dtype=np.float64):
         """
-        uniform(low=0.0, high=1.0, size=None)
+        uniform(low=0.0, high=1.0, size=None, threads=None, dtype=np.float64)
 
         Draw samples from a uniform distribution.
 
@@ -1236,6 +1818,19 @@ cdef class RandomState:
             ``m * n * k`` samples are drawn.  If size is ``None`` (default),
             a single value is returned if ``low`` and ``high`` are both scalars.
             Otherwise, ``np.broadcast(low, high).size`` samples are drawn.
+        threads : int, optional
+            Generate the values with this many threads. The output is then
+            drawn in chunks, each from its own substream derived from the
+            state, and is the same for any number of threads but differs
+            from that without `threads`. Default is None, a single stream.
+
+            .. versionadded:: 1.15.0
+        dtype : {float64, float32}, optional
+            Desired dtype of the result. float32 values are drawn from single 32
+            bit outputs of the generator, with 24 bit mantissas, and differ
+            from the float64 values. Default is float64.
+
+            .. versionadded:: 1.15.0
 
         Returns
         -------
@@ -1293,6 +1888,7 @@ cdef class RandomState:
         cdef double flow, fhigh, fscale
         cdef object temp
 
+        single = _is_float32(dtype, 'uniform')
         olow = <ndarray>PyArray_FROM_OTF(low, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
         ohigh = <ndarray>PyArray_FROM_OTF(high, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
 
@@ -1304,8 +1900,20 @@ cdef class RandomState:
             if not npy_isfinite(fscale):
                 raise OverflowError('Range exceeds valid bounds')
 
-            return cont2_array_sc(self.internal_state, rk_uniform, size, flow,
-                                  fscale, self.lock)
+            if single:
+                out = cont0_float_array(self.internal_state, rk_fill_float,
+                                        1 if size is None else size,
+                                        self.lock, threads)
+                out *= fscale
+                out += flow
+                _float32_below_high(out, flow, fhigh)
+                return out[0] if size is None else out
+            return cont2_fill_array_sc(self.internal_state, rk_uniform,
+                                       rk_fill_double, size, flow, fscale,
+                                       self.lock, threads)
+
+        if threads is not None:
+            raise ValueError("threads requires scalar low and high")
 
         temp = np.subtract(ohigh, olow)
         Py_INCREF(temp)  # needed to get around Pyrex's automatic reference-counting
@@ -1315,6 +1923,14 @@ cdef class RandomState:
         if not np.all(np.isfinite(odiff)):
             raise OverflowError('Range exceeds valid bounds')
 
+        if single:
+            if size is None:
+                size = np.broadcast(olow, odiff).shape
+            out = cont0_float_array(self.internal_state, rk_fill_float, size,
+                                    self.lock)
+            out *= odiff
+            out += olow
+            return _float32_below_high(out, olow, ohigh)
         return cont2_array(self.internal_state, rk_uniform, size, olow, odiff,
                            self.lock)
 
@@ -1516,9 +2132,9 @@ cdef class RandomState:
 
 
     # Complicated, continuous distributions:
-    def standard_normal(self, size=None):
+    def standard_normal(self, size=None, threads=None, dtype=np.float64):
         """
-        standard_normal(size=None)
+        standard_normal(size=None, threads=None, dtype=np.float64)
 
         Draw samples from a standard Normal distribution (mean=0, stdev=1).
 
@@ -1528,6 +2144,19 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        threads : int, optional
+            Generate the values with this many threads. The output is then
+            drawn in chunks, each from its own substream derived from the
+            state, and is the same for any number of threads but differs
+            from that without `threads`. Default is None, a single stream.
+
+            .. versionadded:: 1.15.0
+        dtype : {float64, float32}, optional
+            Desired dtype of the result. float32 values are drawn with the
+            ziggurat method from single 32 bit outputs of the generator,
+            whatever the method of the `RandomState`. Default is float64.
+
+            .. versionadded:: 1.15.0
 
         Returns
         -------
@@ -1547,11 +2176,15 @@ cdef class RandomState:
         (3, 4, 2)
 
         """
-        return cont0_array(self.internal_state, rk_gauss, size, self.lock)
+        if _is_float32(dtype, 'standard_normal'):
+            return cont0_float_array(self.internal_state, rk_fill_gauss_float,
+                                     size, self.lock, threads)
+        return cont0_fill_array(self.internal_state, rk_gauss, rk_fill_gauss,
+                                size, self.lock, threads)
 
-    def normal(self, loc=0.0, scale=1.0, size=None):
+    def normal(self, loc=0.0, scale=1.0, size=None, threads=None):
         """
-        normal(loc=0.0, scale=1.0, size=None)
+        normal(loc=0.0, scale=1.0, size=None, threads=None)
 
         Draw random samples from a normal (Gaussian) distribution.
 
@@ -1576,6 +2209,13 @@ cdef class RandomState:
             ``m * n * k`` samples are drawn.  If size is ``None`` (default),
             a single value is returned if ``loc`` and ``scale`` are both scalars.
             Otherwise, ``np.broadcast(loc, scale).size`` samples are drawn.
+        threads : int, optional
+            Generate the values with this many threads. The output is then
+            drawn in chunks, each from its own substream derived from the
+            state, and is the same for any number of threads but differs
+            from that without `threads`. Default is None, a single stream.
+
+            .. versionadded:: 1.15.0
 
         Returns
         -------
@@ -1649,8 +2289,12 @@ cdef class RandomState:
             fscale = PyFloat_AsDouble(scale)
             if np.signbit(fscale):
                 raise ValueError("scale < 0")
-            return cont2_array_sc(self.internal_state, rk_normal, size, floc,
-                                  fscale, self.lock)
+            return cont2_fill_array_sc(self.internal_state, rk_normal,
+                                       rk_fill_gauss, size, floc, fscale,
+                                       self.lock, threads)
+
+        if threads is not None:
+            raise ValueError("threads requires scalar loc and scale")
 
         if np.any(np.signbit(oscale)):
             raise ValueError("scale < 0")
@@ -1781,9 +2425,10 @@ cdef class RandomState:
         return cont1_array(self.internal_state, rk_exponential, size, oscale,
                            self.lock)
 
-    def standard_exponential(self, size=None):
+    def standard_exponential(self, size=None, threads=None,
+                             dtype=np.float64):
         """
-        standard_exponential(size=None)
+        standard_exponential(size=None, threads=None, dtype=np.float64)
 
         Draw samples from the standard exponential distribution.
 
@@ -1796,6 +2441,19 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        threads : int, optional
+            Generate the values with this many threads. The output is then
+            drawn in chunks, each from its own substream derived from the
+            state, and is the same for any number of threads but differs
+            from that without `threads`. Default is None, a single stream.
+
+            .. versionadded:: 1.15.0
+        dtype : {float64, float32}, optional
+            Desired dtype of the result. float32 values are drawn with the
+            ziggurat method from single 32 bit outputs of the generator,
+            whatever the method of the `RandomState`. Default is float64.
+
+            .. versionadded:: 1.15.0
 
         Returns
         -------
@@ -1809,8 +2467,13 @@ cdef class RandomState:
         >>> n = np.random.standard_exponential((3, 8000))
 
         """
-        return cont0_array(self.internal_state, rk_standard_exponential, size,
-                           self.lock)
+        if _is_float32(dtype, 'standard_exponential'):
+            return cont0_float_array(self.internal_state,
+                                     rk_fill_standard_exponential_float, size,
+                                     self.lock, threads)
+        return cont0_fill_array(self.internal_state, rk_standard_exponential,
+                                rk_fill_standard_exponential, size,
+                                self.lock, threads)
 
     def standard_gamma(self, shape, size=None):
         """
@@ -4478,8 +5141,6 @@ cdef class RandomState:
         [True, True]
 
         """
-        from numpy.dual import svd
-
         # Check preconditions on arguments
         mean = np.array(mean)
         cov = np.array(cov)
@@ -4506,38 +5167,71 @@ cdef class RandomState:
         x = self.standard_normal(final_shape).reshape(-1, mean.shape[0])
 
         # Transform matrix of standard normals into matrix where each row
-        # contains multivariate normals with the desired covariance.
-        # Compute A such that dot(transpose(A),A) == cov.
-        # Then the matrix products of the rows of x and A has the desired
-        # covariance. Note that sqrt(s)*v where (u,s,v) is the singular value
-        # decomposition of cov is such an A.
-        #
-        # Also check that cov is symmetric positive-semidefinite. If so, the u.T and v
-        # matrices should be equal up to roundoff error if cov is
-        # symmetric and the singular value of the corresponding row is
-        # not zero. We continue to use the SVD rather than Cholesky in
-        # order to preserve current outputs.
+        # contains multivariate normals with the desired covariance. We
+        # continue to use the SVD rather than Cholesky in order to preserve
+        # current outputs.
+        x = np.dot(x, _mvn_factor(cov, 'svd', check_valid, tol))
+        x += mean
+        x.shape = tuple(final_shape)
+        return x
 
-        (u, s, v) = svd(cov)
+    def multivariate_normal_sampler(self, mean, cov, method='cholesky',
+                                    check_valid='warn', tol=1e-8):
+        """
+        multivariate_normal_sampler(mean, cov, method='cholesky',
+                                    check_valid='warn', tol=1e-8)
 
-        if check_valid != 'ignore':
-            if check_valid != 'warn' and check_valid != 'raise':
-                raise ValueError("check_valid must equal 'warn', 'raise', or 'ignore'")
+        Prepare repeated draws from a multivariate normal distribution.
 
-            psd = np.allclose(np.dot(v.T * s, v), cov, rtol=tol, atol=tol)
-            if not psd:
-                if check_valid == 'warn':
-                    warnings.warn(
-                        "covariance is not symmetric positive-semidefinite.",
-                        RuntimeWarning)
-                else:
-                    raise ValueError(
-                        "covariance is not symmetric positive-semidefinite.")
+        `multivariate_normal` factorizes the covariance matrix on every
+        call. The sampler factorizes it once, after which each call of
+        ``sampler.sample(size)`` only draws a block of standard normals from
+        this `RandomState` and multiplies it by the factor.
 
-        x = np.dot(x, np.sqrt(s)[:, None] * v)
-        x += mean
-        x.shape = tuple(final_shape)
-        return x
+        Parameters
+        ----------
+        mean : 1-D array_like, of length N
+            Mean of the N-dimensional distribution.
+        cov : 2-D array_like, of shape (N, N)
+            Covariance matrix of the distribution. It must be symmetric and
+            positive-semidefinite for proper sampling.
+        method : { 'cholesky', 'eigh', 'svd' }, optional
+            Factorization of the covariance matrix. 'cholesky' is the
+            fastest and falls back on 'eigh' if `cov` is singular. 'svd'
+            gives the same values as `multivariate_normal`.
+        check_valid : { 'warn', 'raise', 'ignore' }, optional
+            Behavior when the covariance matrix is not positive semidefinite.
+        tol : float, optional
+            Tolerance when checking the factorization of the covariance
+            matrix.
+
+        Returns
+        -------
+        sampler : MultivariateNormalSampler
+            An object with the method ``sample(size=None)`` returning the
+            drawn samples, of shape ``size + (N,)``, or ``(N,)`` if size is
+            None.
+
+        See Also
+        --------
+        multivariate_normal
+
+        Notes
+        -----
+        .. versionadded:: 1.15.0
+
+        Examples
+        --------
+        >>> sampler = np.random.multivariate_normal_sampler(
+        ...     [1, 2], [[1, 0.5], [0.5, 1]])
+        >>> sampler.sample((3, 3)).shape
+        (3, 3, 2)
+        >>> sampler.sample().shape
+        (2,)
+
+        """
+        return MultivariateNormalSampler(self, mean, cov, method,
+                                         check_valid, tol)
 
     def multinomial(self, npy_intp n, object pvals, size=None):
         """
@@ -4918,7 +5612,227 @@ cdef class RandomState:
         idx = np.arange(arr.shape[0], dtype=np.intp)
         self.shuffle(idx)
         return arr[idx]
-        
+
+    def alias_sampler(self, a, p):
+        """
+        alias_sampler(a, p)
+
+        Prepare repeated weighted draws from a given 1-D array.
+
+        Sets up the alias table of Walker's method in O(n) time, after which
+        each draw of ``sampler.sample(size)`` takes constant time, drawing
+        from this `RandomState`. This is faster than
+        ``choice(a, size, p=p)``, which searches the cumulative
+        distribution for every value, if many values are drawn in total.
+
+        Parameters
+        ----------
+        a : 1-D array-like or int
+            If an ndarray, the samples are drawn from its elements. If an
+            int, they are drawn as if a were np.arange(a).
+        p : 1-D array-like
+            The probabilities associated with each entry in a.
+
+        Returns
+        -------
+        sampler : AliasSampler
+            An object with the method ``sample(size=None)`` returning a
+            single value, or an array of shape `size`, of independent draws.
+
+        Raises
+        ------
+        ValueError
+            If a is an int and less than zero, if a or p are not
+            1-dimensional, if a is an array-like of size 0, if p is not a
+            vector of probabilities or if a and p have different lengths.
+
+        See Also
+        --------
+        choice
+
+        Notes
+        -----
+        The table is built with Vose's method [1]_. The values differ from
+        those of `choice` for the same state.
+
+        .. versionadded:: 1.15.0
+
+        References
+        ----------
+        .. [1] M. D. Vose, "A Linear Algorithm For Generating Random Numbers
+               With a Given Distribution", IEEE Transactions on Software
+               Engineering, Vol. 17, No. 9, pp. 972-975, 1991.
+
+        Examples
+        --------
+        >>> sampler = np.random.alias_sampler(5, [0.1, 0, 0.3, 0.6, 0])
+        >>> sampler.sample(3)
+        array([3, 3, 0])
+        >>> sampler.sample()
+        2
+
+        """
+        return AliasSampler(self, a, p)
+
+
+cdef class AliasSampler:
+    """
+    Repeated weighted draws with the alias method, see
+    `RandomState.alias_sampler`.
+    """
+    cdef RandomState random_state
+    cdef object population
+    cdef ndarray prob
+    cdef ndarray alias
+    cdef npy_intp n
+
+    def __init__(self, RandomState random_state, a, p):
+        cdef ndarray scaled, stack
+        cdef double *scaled_data
+        cdef double *prob_data
+        cdef npy_intp *alias_data
+        cdef npy_intp *stack_data
+        cdef npy_intp i, l, g, nsmall, nlarge
+
+        a, pop_size = _population(a)
+        p = _probabilities(p, pop_size)
+        self.random_state = random_state
+        self.population = a if a.ndim else None
+        self.n = pop_size
+
+        # Vose's method: entries below the mean each take their complement
+        # from an entry above, one pair at a time. The small entries are
+        # kept at the front of stack, the large ones at the back.
+        scaled = <ndarray>(p*(pop_size/p.sum()))
+        self.prob = <ndarray>np.ones(pop_size)
+        self.alias = <ndarray>np.arange(pop_size, dtype=np.intp)
+        stack = <ndarray>np.empty(pop_size, dtype=np.intp)
+        scaled_data = <double *>PyArray_DATA(scaled)
+        prob_data = <double *>PyArray_DATA(self.prob)
+        alias_data = <npy_intp *>PyArray_DATA(self.alias)
+        stack_data = <npy_intp *>PyArray_DATA(stack)
+        with nogil:
+            nsmall = 0
+            nlarge = self.n
+            for i in range(self.n):
+                if scaled_data[i] < 1.0:
+                    stack_data[nsmall] = i
+                    nsmall += 1
+                else:
+                    nlarge -= 1
+                    stack_data[nlarge] = i
+            while nsmall > 0 and nlarge < self.n:
+                nsmall -= 1
+                l = stack_data[nsmall]
+                g = stack_data[nlarge]
+                prob_data[l] = scaled_data[l]
+                alias_data[l] = g
+                scaled_data[g] = (scaled_data[g] + scaled_data[l]) - 1.0
+                if scaled_data[g] < 1.0:
+                    nlarge += 1
+                    stack_data[nsmall] = g
+                    nsmall += 1
+        # what is left is 1 up to rounding, and keeps prob 1
+
+    def sample(self, size=None):
+        """
+        sample(size=None)
+
+        Draw from the distribution of the sampler.
+
+        Parameters
+        ----------
+        size : int or tuple of ints, optional
+            Output shape. Default is None, in which case a single value is
+            returned.
+
+        Returns
+        -------
+        samples : single item or ndarray
+            The generated random samples.
+        """
+        cdef ndarray idx "arrayObject_idx"
+        cdef npy_intp *idx_data
+        cdef double *prob_data = <double *>PyArray_DATA(self.prob)
+        cdef npy_intp *alias_data = <npy_intp *>PyArray_DATA(self.alias)
+        cdef rk_state *state = self.random_state.internal_state
+        cdef npy_intp i, j, length
+
+        idx = <ndarray>np.empty(() if size is None else size, dtype=np.intp)
+        length = PyArray_SIZE(idx)
+        idx_data = <npy_intp *>PyArray_DATA(idx)
+        with self.random_state.lock, nogil:
+            for i in range(length):
+                j = rk_interval(self.n - 1, state)
+                if rk_double(state) >= prob_data[j]:
+                    j = alias_data[j]
+                idx_data[i] = j
+
+        if self.population is None:
+            return idx.item() if size is None else idx
+        if size is None:
+            return self.population[idx[()]]
+        if idx.ndim == 0:
+            # a 0-d array even for object arrays, as in choice
+            res = np.empty((), dtype=self.population.dtype)
+            res[()] = self.population[idx[()]]
+            return res
+        return self.population[idx]
+
+
+cdef class MultivariateNormalSampler:
+    """
+    Repeated multivariate normal draws with a cached factorization of the
+    covariance, see `RandomState.multivariate_normal_sampler`.
+    """
+    cdef RandomState random_state
+    cdef ndarray mean
+    cdef ndarray factor
+
+    def __init__(self, RandomState random_state, mean, cov,
+                 method='cholesky', check_valid='warn', tol=1e-8):
+        mean = np.array(mean, dtype=np.double)
+        cov = np.array(cov)
+        if len(mean.shape) != 1:
+            raise ValueError("mean must be 1 dimensional")
+        if (len(cov.shape) != 2) or (cov.shape[0] != cov.shape[1]):
+            raise ValueError("cov must be 2 dimensional and square")
+        if mean.shape[0] != cov.shape[0]:
+            raise ValueError("mean and cov must have same length")
+        self.random_state = random_state
+        self.mean = <ndarray>mean
+        self.factor = <ndarray>np.ascontiguousarray(
+            _mvn_factor(cov, method, check_valid, tol), dtype=np.double)
+
+    def sample(self, size=None):
+        """
+        sample(size=None)
+
+        Draw from the distribution of the sampler.
+
+        Parameters
+        ----------
+        size : int or tuple of ints, optional
+            Given a shape of, for example, ``(m,n,k)``, ``m*n*k`` samples are
+            generated. Default is None, in which case a single sample is
+            returned.
+
+        Returns
+        -------
+        out : ndarray
+            The drawn samples, of shape ``size + (N,)``, or ``(N,)`` if size
+            is None.
+        """
+        cdef npy_intp d = PyArray_DIM(self.mean, 0)
+
+        shape = _shape_from_size(size, d)
+        # a single gemm on the whole block of standard normals
+        x = np.dot(self.random_state.standard_normal(shape).reshape(-1, d),
+                   self.factor)
+        x += self.mean
+        x.shape = shape
+        return x
+
 
 _rand = RandomState()
 seed = _rand.seed
@@ -4926,6 +5840,7 @@ get_state = _rand.get_state
 set_state = _rand.set_state
 random_sample = _rand.random_sample
 choice = _rand.choice
+alias_sampler = _rand.alias_sampler
 randint = _rand.randint
 bytes = _rand.bytes
 uniform = _rand.uniform
@@ -4966,6 +5881,7 @@ hypergeometric = _rand.hypergeometric
 logseries = _rand.logseries
 
 multivariate_normal = _rand.multivariate_normal
+multivariate_normal_sampler = _rand.multivariate_normal_sampler
 multinomial = _rand.multinomial
 dirichlet = _rand.dirichlet
 
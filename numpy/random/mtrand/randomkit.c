@@ -119,10 +119,13 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <limits.h>
 #include <math.h>
 #include <assert.h>
+#include "ziggurat.h"
+#include "mt19937_jump.h"
 
 #ifndef RK_DEV_URANDOM
 #define RK_DEV_URANDOM "/dev/urandom"
@@ -156,6 +159,7 @@ rk_seed(unsigned long seed, rk_state *state)
     state->gauss = 0;
     state->has_gauss = 0;
     state->has_binomial = 0;
+    rk_seed_brng(state);
 }
 
 /* Thomas Wang 32 bits integer hash function */
@@ -192,6 +196,7 @@ rk_randomseed(rk_state *state)
         for (i = 0; i < 624; i++) {
             state->key[i] &= 0xffffffffUL;
         }
+        rk_seed_brng(state);
         return RK_NOERR;
     }
 
@@ -219,50 +224,527 @@ rk_randomseed(rk_state *state)
  * Note that regardless of the precision of long, only 32 bit random
  * integers are produced
  */
-unsigned long
-rk_random(rk_state *state)
+static void
+rk_mt19937_refill(rk_state *state)
 {
     unsigned long y;
+    int i;
+
+    for (i = 0; i < N - M; i++) {
+        y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
+        state->key[i] = state->key[i+M] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
+    }
+    for (; i < N - 1; i++) {
+        y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
+        state->key[i] = state->key[i+(M-N)] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
+    }
+    y = (state->key[N - 1] & UPPER_MASK) | (state->key[0] & LOWER_MASK);
+    state->key[N - 1] = state->key[M - 1] ^ (y >> 1) ^ (-(y & 1) & MATRIX_A);
+
+    state->pos = 0;
+}
+
+static NPY_INLINE unsigned long
+rk_mt19937_temper(unsigned long y)
+{
+    y ^= (y >> 11);
+    y ^= (y << 7) & 0x9d2c5680UL;
+    y ^= (y << 15) & 0xefc60000UL;
+    y ^= (y >> 18);
+    return y;
+}
 
+static NPY_INLINE unsigned long
+rk_mt19937(rk_state *state)
+{
     if (state->pos == RK_STATE_LEN) {
-        int i;
+        rk_mt19937_refill(state);
+    }
+    return rk_mt19937_temper(state->key[state->pos++]);
+}
+
+/*
+ * 64 x 64 -> 128 bit multiplication, returns the lower half of the product
+ * and stores the upper half in *hi.
+ */
+static NPY_INLINE npy_uint64
+rk_umul128(npy_uint64 a, npy_uint64 b, npy_uint64 *hi)
+{
+#ifdef __SIZEOF_INT128__
+    __uint128_t p = (__uint128_t)a * b;
 
-        for (i = 0; i < N - M; i++) {
-            y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
-            state->key[i] = state->key[i+M] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
+    *hi = (npy_uint64)(p >> 64);
+    return (npy_uint64)p;
+#else
+    npy_uint64 a_lo = a & 0xffffffffULL, a_hi = a >> 32;
+    npy_uint64 b_lo = b & 0xffffffffULL, b_hi = b >> 32;
+    npy_uint64 p0 = a_lo * b_lo, p1 = a_lo * b_hi;
+    npy_uint64 p2 = a_hi * b_lo, p3 = a_hi * b_hi;
+    npy_uint64 mid = (p0 >> 32) + (p1 & 0xffffffffULL) + (p2 & 0xffffffffULL);
+
+    *hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+    return (mid << 32) | (p0 & 0xffffffffULL);
+#endif
+}
+
+/* a = a * b + c modulo 2**128, the words stored as (hi, lo) */
+static NPY_INLINE void
+rk_muladd128(npy_uint64 *a, const npy_uint64 *b, const npy_uint64 *c)
+{
+    npy_uint64 hi, lo;
+
+    lo = rk_umul128(a[1], b[1], &hi);
+    hi += a[0] * b[1] + a[1] * b[0];
+    lo += c[1];
+    hi += c[0] + (lo < c[1]);
+    a[0] = hi;
+    a[1] = lo;
+}
+
+static NPY_INLINE npy_uint64
+rk_rotl64(npy_uint64 x, unsigned int k)
+{
+    return (x << k) | (x >> ((64 - k) & 63));
+}
+
+/*
+ * PCG64, O'Neill's permuted congruential generator with 128 bit state and
+ * the XSL RR output function, i.e. pcg_setseq_128_xsl_rr_64 of the
+ * reference implementation. The 128 bit words are kept as (hi, lo) pairs.
+ */
+static const npy_uint64 pcg_mult[2] = {2549297995355413924ULL,
+                                       4865540595714422341ULL};
+
+static NPY_INLINE void
+rk_pcg64_step(npy_uint64 *s)
+{
+    rk_muladd128(s, pcg_mult, s + 2);
+}
+
+/*
+ * Advance the LCG by delta steps in O(log(delta)), F. Brown, "Random number
+ * generation with arbitrary stride", Trans. Am. Nucl. Soc. (1994).
+ */
+static void
+rk_pcg64_advance(npy_uint64 *s, const npy_uint64 *delta)
+{
+    static const npy_uint64 zero[2] = {0, 0};
+    npy_uint64 acc_mult[2], acc_plus[2], cur_mult[2], cur_plus[2], t[2];
+    int i;
+
+    acc_mult[0] = 0;
+    acc_mult[1] = 1;
+    acc_plus[0] = acc_plus[1] = 0;
+    cur_mult[0] = pcg_mult[0];
+    cur_mult[1] = pcg_mult[1];
+    cur_plus[0] = s[2];
+    cur_plus[1] = s[3];
+    for (i = 0; i < 128; i++) {
+        if ((delta[i < 64] >> (i & 63)) & 1) {
+            rk_muladd128(acc_mult, cur_mult, zero);
+            rk_muladd128(acc_plus, cur_mult, cur_plus);
         }
-        for (; i < N - 1; i++) {
-            y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
-            state->key[i] = state->key[i+(M-N)] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
+        /* cur_plus *= cur_mult + 1, cur_mult *= cur_mult */
+        t[1] = cur_mult[1] + 1;
+        t[0] = cur_mult[0] + (t[1] == 0);
+        rk_muladd128(cur_plus, t, zero);
+        rk_muladd128(cur_mult, cur_mult, zero);
+    }
+    rk_muladd128(s, acc_mult, acc_plus);
+}
+
+static NPY_INLINE npy_uint64
+rk_pcg64_next(npy_uint64 *s)
+{
+    unsigned int rot;
+
+    rk_pcg64_step(s);
+    rot = (unsigned int)(s[0] >> 58);
+    return rk_rotl64(s[0] ^ s[1], (64 - rot) & 63);
+}
+
+/*
+ * Philox4x64-10 of Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3". Each 256 bit counter is encrypted into four outputs.
+ */
+#define PHILOX_M0 0xD2E7470EE14C6C93ULL
+#define PHILOX_M1 0xCA5A826395121157ULL
+#define PHILOX_W0 0x9E3779B97F4A7C15ULL
+#define PHILOX_W1 0xBB67AE8584CAA73BULL
+
+static void
+rk_philox_block(const npy_uint64 *ctr, const npy_uint64 *key, npy_uint64 *out)
+{
+    npy_uint64 c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    npy_uint64 k0 = key[0], k1 = key[1];
+    int i;
+
+    for (i = 0; i < 10; i++) {
+        npy_uint64 hi0, hi1, lo0, lo1;
+
+        if (i > 0) {
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
         }
-        y = (state->key[N - 1] & UPPER_MASK) | (state->key[0] & LOWER_MASK);
-        state->key[N - 1] = state->key[M - 1] ^ (y >> 1) ^ (-(y & 1) & MATRIX_A);
+        lo0 = rk_umul128(PHILOX_M0, c0, &hi0);
+        lo1 = rk_umul128(PHILOX_M1, c2, &hi1);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
 
-        state->pos = 0;
+static NPY_INLINE npy_uint64
+rk_philox_next(rk_state *state)
+{
+    npy_uint64 *s = state->bstate;
+
+    if (state->bpos == 4) {
+        /* 256 bit counter increment */
+        if (++s[0] == 0 && ++s[1] == 0 && ++s[2] == 0) {
+            ++s[3];
+        }
+        rk_philox_block(s, s + 4, s + 6);
+        state->bpos = 0;
     }
-    y = state->key[state->pos++];
+    return s[6 + state->bpos++];
+}
 
-    /* Tempering */
-    y ^= (y >> 11);
-    y ^= (y << 7) & 0x9d2c5680UL;
-    y ^= (y << 15) & 0xefc60000UL;
-    y ^= (y >> 18);
+/* xoshiro256** of Blackman and Vigna */
+static NPY_INLINE npy_uint64
+rk_xoshiro256_next(npy_uint64 *s)
+{
+    const npy_uint64 result = rk_rotl64(s[1] * 5, 7) * 9;
+    const npy_uint64 t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rk_rotl64(s[3], 45);
+    return result;
+}
 
-    return y;
+/* Next 64 bits of the generators other than MT19937 */
+static NPY_INLINE npy_uint64
+rk_brng_next64(rk_state *state)
+{
+    switch (state->brng) {
+        case RK_PCG64:
+            return rk_pcg64_next(state->bstate);
+        case RK_PHILOX:
+            return rk_philox_next(state);
+        default:
+            return rk_xoshiro256_next(state->bstate);
+    }
 }
 
+void
+rk_seed_brng(rk_state *state)
+{
+    npy_uint64 seed[4], *s = state->bstate;
+    int i;
+
+    state->has_uint32 = 0;
+    state->uinteger = 0;
+    state->bpos = 4;
+    for (i = 0; i < RK_BSTATE_LEN; i++) {
+        s[i] = 0;
+    }
+    if (state->brng == RK_MT19937) {
+        return;
+    }
+    for (i = 0; i < 4; i++) {
+        seed[i] = (npy_uint64)rk_mt19937(state) << 32;
+        seed[i] |= rk_mt19937(state);
+    }
+    switch (state->brng) {
+        case RK_PCG64:
+            /* pcg_setseq_128_srandom_r(initstate=seed[0:2], initseq=seed[2:4]) */
+            s[2] = (seed[2] << 1) | (seed[3] >> 63);
+            s[3] = (seed[3] << 1) | 1;
+            rk_pcg64_step(s);
+            s[1] += seed[1];
+            s[0] += seed[0] + (s[1] < seed[1]);
+            rk_pcg64_step(s);
+            break;
+        case RK_PHILOX:
+            s[4] = seed[0];
+            s[5] = seed[1];
+            break;
+        default:
+            for (i = 0; i < 4; i++) {
+                s[i] = seed[i];
+            }
+            if (!(s[0] | s[1] | s[2] | s[3])) {
+                /* the all zero state is a fixed point */
+                s[0] = 1;
+            }
+            break;
+    }
+}
 
 /*
- * Returns an unsigned 64 bit random integer.
+ * Advance MT19937 by the number of steps encoded in the jump polynomial
+ * poly, q(A) s accumulated from the states A^i s. The window key[0..623]
+ * is advanced as a whole, which leaves the position in it unchanged.
  */
-NPY_INLINE static npy_uint64
-rk_uint64(rk_state *state)
+static void
+rk_mt19937_jump(rk_state *state, const npy_uint32 *poly, int degree)
+{
+    unsigned long cur[RK_STATE_LEN], acc[RK_STATE_LEN], y;
+    int i, j, k = 0; /* cur is a ring buffer starting at k */
+
+    memcpy(cur, state->key, sizeof(cur));
+    memset(acc, 0, sizeof(acc));
+    for (i = 0; i <= degree; i++) {
+        if ((poly[i >> 5] >> (i & 31)) & 1) {
+            for (j = 0; j < N - k; j++) {
+                acc[j] ^= cur[k + j];
+            }
+            for (; j < N; j++) {
+                acc[j] ^= cur[k + j - N];
+            }
+        }
+        /* replace the oldest word by the next one of the sequence */
+        y = (cur[k] & UPPER_MASK) | (cur[(k + 1) % N] & LOWER_MASK);
+        cur[k] = cur[(k + M) % N] ^ (y >> 1) ^ (-(y & 1) & MATRIX_A);
+        k = (k + 1) % N;
+    }
+    memcpy(state->key, acc, sizeof(acc));
+}
+
+static void
+rk_xoshiro256_jump(npy_uint64 *s)
+{
+    static const npy_uint64 jump[4] = {
+        0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+        0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+    npy_uint64 t[4] = {0, 0, 0, 0};
+    int i, b;
+
+    for (i = 0; i < 4; i++) {
+        for (b = 0; b < 64; b++) {
+            if ((jump[i] >> b) & 1) {
+                t[0] ^= s[0];
+                t[1] ^= s[1];
+                t[2] ^= s[2];
+                t[3] ^= s[3];
+            }
+            rk_xoshiro256_next(s);
+        }
+    }
+    memcpy(s, t, sizeof(t));
+}
+
+void
+rk_jump(rk_state *state)
+{
+    /* 2**128 / golden ratio, odd */
+    static const npy_uint64 pcg_jump[2] = {0x9e3779b97f4a7c15ULL,
+                                           0xf39cc0605cedc835ULL};
+    npy_uint64 *s = state->bstate;
+
+    switch (state->brng) {
+        case RK_MT19937:
+            rk_mt19937_jump(state, mt_jump_poly, MT_JUMP_DEGREE);
+            break;
+        case RK_PCG64:
+            rk_pcg64_advance(s, pcg_jump);
+            break;
+        case RK_PHILOX:
+            if (++s[2] == 0) {
+                ++s[3];
+            }
+            state->bpos = 4;
+            break;
+        default:
+            rk_xoshiro256_jump(s);
+            break;
+    }
+    state->has_uint32 = 0;
+    state->has_gauss = 0;
+    state->gauss = 0;
+    state->has_binomial = 0;
+}
+
+unsigned long
+rk_random(rk_state *state)
 {
-    npy_uint64 upper = (npy_uint64)rk_random(state) << 32;
-    npy_uint64 lower = (npy_uint64)rk_random(state);
+    npy_uint64 r;
+
+    if (state->brng == RK_MT19937) {
+        return rk_mt19937(state);
+    }
+    if (state->has_uint32) {
+        state->has_uint32 = 0;
+        return state->uinteger;
+    }
+    r = rk_brng_next64(state);
+    state->has_uint32 = 1;
+    state->uinteger = (npy_uint32)(r >> 32);
+    return (unsigned long)(r & 0xffffffffUL);
+}
+
+
+static NPY_INLINE npy_uint64
+rk_next_uint64(rk_state *state)
+{
+    npy_uint64 upper, lower;
+
+    if (state->brng != RK_MT19937) {
+        return rk_brng_next64(state);
+    }
+    upper = (npy_uint64)rk_mt19937(state) << 32;
+    lower = (npy_uint64)rk_mt19937(state);
     return upper | lower;
 }
 
+static NPY_INLINE double
+rk_next_double(rk_state *state)
+{
+    /* shifts : 67108864 = 0x4000000, 9007199254740992 = 0x20000000000000 */
+    long a, b;
+
+    if (state->brng != RK_MT19937) {
+        return (rk_brng_next64(state) >> 11) / 9007199254740992.0;
+    }
+    a = rk_mt19937(state) >> 5;
+    b = rk_mt19937(state) >> 6;
+    return (a * 67108864.0 + b) / 9007199254740992.0;
+}
+
+npy_uint64
+rk_uint64(rk_state *state)
+{
+    return rk_next_uint64(state);
+}
+
+/* Number of draws made at a time by the bulk fills */
+#define RK_FILL_CHUNK 256
+
+/* cnt 64 bit draws of the generators other than MT19937 */
+static void
+rk_brng_fill64(npy_intp cnt, npy_uint64 *out, rk_state *state)
+{
+    npy_intp i;
+
+    switch (state->brng) {
+        case RK_PCG64:
+            for (i = 0; i < cnt; i++) {
+                out[i] = rk_pcg64_next(state->bstate);
+            }
+            break;
+        case RK_PHILOX:
+            for (i = 0; i < cnt; i++) {
+                out[i] = rk_philox_next(state);
+            }
+            break;
+        default:
+            for (i = 0; i < cnt; i++) {
+                out[i] = rk_xoshiro256_next(state->bstate);
+            }
+            break;
+    }
+}
+
+void
+rk_fill_double(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_uint64 buf[RK_FILL_CHUNK];
+    npy_intp i, j, n;
+
+    if (state->brng == RK_MT19937) {
+        for (i = 0; i < cnt; i += n) {
+            const unsigned long *key = state->key + state->pos;
+
+            /* the pairs of words left in the block */
+            n = (RK_STATE_LEN - state->pos) / 2;
+            if (n == 0) {
+                long a = rk_mt19937(state) >> 5, b = rk_mt19937(state) >> 6;
+
+                out[i] = (a * 67108864.0 + b) / 9007199254740992.0;
+                n = 1;
+                continue;
+            }
+            if (n > cnt - i) {
+                n = cnt - i;
+            }
+            for (j = 0; j < n; j++) {
+                long a = rk_mt19937_temper(key[2*j]) >> 5;
+                long b = rk_mt19937_temper(key[2*j + 1]) >> 6;
+
+                out[i + j] = (a * 67108864.0 + b) / 9007199254740992.0;
+            }
+            state->pos += 2*n;
+        }
+        return;
+    }
+    for (i = 0; i < cnt; i += n) {
+        n = (cnt - i < RK_FILL_CHUNK) ? cnt - i : RK_FILL_CHUNK;
+        rk_brng_fill64(n, buf, state);
+        /* separate loop, the signed conversion vectorizes */
+        for (j = 0; j < n; j++) {
+            out[i + j] = (npy_int64)(buf[j] >> 11) / 9007199254740992.0;
+        }
+    }
+}
+
+/* 2**-24, the spacing of the floats drawn from the upper 24 bits */
+#define RK_FLOAT_EPS (1.0f / 16777216.0f)
+
+void
+rk_fill_float(npy_intp cnt, float *out, rk_state *state)
+{
+    npy_uint64 buf[RK_FILL_CHUNK];
+    npy_intp i = 0, j, n;
+
+    if (state->brng == RK_MT19937) {
+        for (; i < cnt; i += n) {
+            const unsigned long *key = state->key + state->pos;
+
+            n = RK_STATE_LEN - state->pos;
+            if (n == 0) {
+                out[i] = (npy_int32)(rk_mt19937(state) >> 8) * RK_FLOAT_EPS;
+                n = 1;
+                continue;
+            }
+            if (n > cnt - i) {
+                n = cnt - i;
+            }
+            for (j = 0; j < n; j++) {
+                out[i + j] = (npy_int32)(rk_mt19937_temper(key[j]) >> 8) *
+                             RK_FLOAT_EPS;
+            }
+            state->pos += n;
+        }
+        return;
+    }
+    /* both halves of the 64 bit draws, in the order rk_random uses them */
+    if (cnt > 0 && state->has_uint32) {
+        out[i++] = (npy_int32)(state->uinteger >> 8) * RK_FLOAT_EPS;
+        state->has_uint32 = 0;
+    }
+    for (; cnt - i >= 2; i += 2*n) {
+        n = ((cnt - i) / 2 < RK_FILL_CHUNK) ? (cnt - i) / 2 : RK_FILL_CHUNK;
+        rk_brng_fill64(n, buf, state);
+        for (j = 0; j < n; j++) {
+            out[i + 2*j] = (npy_int32)((buf[j] & 0xffffffffUL) >> 8) *
+                           RK_FLOAT_EPS;
+            out[i + 2*j + 1] = (npy_int32)(buf[j] >> 40) * RK_FLOAT_EPS;
+        }
+    }
+    if (i < cnt) {
+        out[i] = (npy_int32)(rk_random(state) >> 8) * RK_FLOAT_EPS;
+    }
+}
+
 
 /*
  * Returns an unsigned 32 bit random integer.
@@ -277,6 +759,12 @@ rk_uint32(rk_state *state)
 /*
  * Fills an array with cnt random npy_uint64 between off and off + rng
  * inclusive. The numbers wrap if rng is sufficiently large.
+ *
+ * MT19937 keeps the masked rejection of earlier releases for reproducible
+ * streams. The other generators use Lemire's nearly divisionless method,
+ * "Fast Random Integer Generation in an Interval", ACM Trans. Model.
+ * Comput. Simul. 29 (2019): the upper half of x * (rng + 1) is uniform
+ * unless the lower half falls below 2**64 mod (rng + 1).
  */
 void
 rk_random_uint64(npy_uint64 off, npy_uint64 rng, npy_intp cnt,
@@ -291,6 +779,24 @@ rk_random_uint64(npy_uint64 off, npy_uint64 rng, npy_intp cnt,
         }
         return;
     }
+    if (state->brng != RK_MT19937) {
+        npy_uint64 range = rng + 1, threshold, lo;
+
+        if (range == 0) {
+            for (i = 0; i < cnt; i++) {
+                out[i] = off + rk_next_uint64(state);
+            }
+            return;
+        }
+        threshold = (0 - range) % range;
+        for (i = 0; i < cnt; i++) {
+            do {
+                lo = rk_umul128(rk_next_uint64(state), range, &val);
+            } while (lo < threshold);
+            out[i] = off + val;
+        }
+        return;
+    }
 
     /* Smallest bit mask >= max */
     mask |= mask >> 1;
@@ -314,7 +820,8 @@ rk_random_uint64(npy_uint64 off, npy_uint64 rng, npy_intp cnt,
 
 /*
  * Fills an array with cnt random npy_uint32 between off and off + rng
- * inclusive. The numbers wrap if rng is sufficiently large.
+ * inclusive. The numbers wrap if rng is sufficiently large. As for
+ * rk_random_uint64, Lemire's method is used but for MT19937.
  */
 void
 rk_random_uint32(npy_uint32 off, npy_uint32 rng, npy_intp cnt,
@@ -329,6 +836,25 @@ rk_random_uint32(npy_uint32 off, npy_uint32 rng, npy_intp cnt,
         }
         return;
     }
+    if (state->brng != RK_MT19937) {
+        npy_uint32 range = rng + 1, threshold;
+        npy_uint64 m;
+
+        if (range == 0) {
+            for (i = 0; i < cnt; i++) {
+                out[i] = off + rk_uint32(state);
+            }
+            return;
+        }
+        threshold = (0 - range) % range;
+        for (i = 0; i < cnt; i++) {
+            do {
+                m = (npy_uint64)rk_uint32(state) * range;
+            } while ((npy_uint32)m < threshold);
+            out[i] = off + (npy_uint32)(m >> 32);
+        }
+        return;
+    }
 
     /* Smallest bit mask >= max */
     mask |= mask >> 1;
@@ -515,9 +1041,7 @@ rk_interval(unsigned long max, rk_state *state)
 double
 rk_double(rk_state *state)
 {
-    /* shifts : 67108864 = 0x4000000, 9007199254740992 = 0x20000000000000 */
-    long a = rk_random(state) >> 5, b = rk_random(state) >> 6;
-    return (a * 67108864.0 + b) / 9007199254740992.0;
+    return rk_next_double(state);
 }
 
 void
@@ -597,9 +1121,88 @@ rk_altfill(void *buffer, size_t size, int strong, rk_state *state)
     return err;
 }
 
+/*
+ * Ziggurat method of Marsaglia and Tsang with 256 layers, taking the layer,
+ * sign and a 52 bit abscissa from one 64 bit draw. See ziggurat.h for the
+ * layout of the tables.
+ */
+static double
+rk_gauss_zig(rk_state *state)
+{
+    for (;;) {
+        npy_uint64 r = rk_next_uint64(state);
+        int idx = r & 0xff;
+        int sign = (r >> 8) & 0x1;
+        npy_uint64 rabs = (r >> 9) & 0x000fffffffffffffULL;
+        double x = rabs * zig_nor_w[idx];
+
+        if (sign) {
+            x = -x;
+        }
+        if (rabs < zig_nor_k[idx]) {
+            /* inside the rectangle, about 99% of the draws */
+            return x;
+        }
+        if (idx == 0) {
+            /* the tail beyond ZIG_NOR_R */
+            double xx, yy;
+
+            do {
+                xx = -log(1.0 - rk_next_double(state)) / ZIG_NOR_R;
+                yy = -log(1.0 - rk_next_double(state));
+            } while (yy + yy <= xx*xx);
+            return sign ? -(ZIG_NOR_R + xx) : ZIG_NOR_R + xx;
+        }
+        if (zig_nor_f[idx] + rk_next_double(state)*(zig_nor_f[idx - 1] -
+                zig_nor_f[idx]) < exp(-0.5*x*x)) {
+            return x;
+        }
+    }
+}
+
+/*
+ * The same ziggurat with the layer, sign and a 23 bit abscissa taken from
+ * one 32 bit draw, for single precision. The abscissa is scaled to 52 bits
+ * to use the tables of rk_gauss_zig.
+ */
+static float
+rk_gauss_zig_float(rk_state *state)
+{
+    for (;;) {
+        npy_uint32 r = (npy_uint32)rk_random(state);
+        int idx = r & 0xff;
+        int sign = (r >> 8) & 0x1;
+        npy_uint64 rabs = (npy_uint64)(r >> 9) << 29;
+        double x = rabs * zig_nor_w[idx];
+
+        if (sign) {
+            x = -x;
+        }
+        if (rabs < zig_nor_k[idx]) {
+            return (float)x;
+        }
+        if (idx == 0) {
+            double xx, yy;
+
+            do {
+                xx = -log(1.0 - rk_next_double(state)) / ZIG_NOR_R;
+                yy = -log(1.0 - rk_next_double(state));
+            } while (yy + yy <= xx*xx);
+            return (float)(sign ? -(ZIG_NOR_R + xx) : ZIG_NOR_R + xx);
+        }
+        if (zig_nor_f[idx] + rk_next_double(state)*(zig_nor_f[idx - 1] -
+                zig_nor_f[idx]) < exp(-0.5*x*x)) {
+            return (float)x;
+        }
+    }
+}
+
 double
 rk_gauss(rk_state *state)
 {
+    if (state->method == RK_ZIGGURAT) {
+        return rk_gauss_zig(state);
+    }
     if (state->has_gauss) {
         const double tmp = state->gauss;
         state->gauss = 0;
@@ -610,8 +1213,8 @@ rk_gauss(rk_state *state)
         double f, x1, x2, r2;
 
         do {
-            x1 = 2.0*rk_double(state) - 1.0;
-            x2 = 2.0*rk_double(state) - 1.0;
+            x1 = 2.0*rk_next_double(state) - 1.0;
+            x2 = 2.0*rk_next_double(state) - 1.0;
             r2 = x1*x1 + x2*x2;
         }
         while (r2 >= 1.0 || r2 == 0.0);
@@ -624,3 +1227,52 @@ rk_gauss(rk_state *state)
         return f*x2;
     }
 }
+
+void
+rk_fill_gauss(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i = 0;
+
+    if (state->method == RK_ZIGGURAT) {
+        for (; i < cnt; i++) {
+            out[i] = rk_gauss_zig(state);
+        }
+        return;
+    }
+    /* the pairs of the polar method, in the order rk_gauss returns them */
+    if (cnt > 0 && state->has_gauss) {
+        out[i++] = state->gauss;
+        state->gauss = 0;
+        state->has_gauss = 0;
+    }
+    for (; i < cnt; i += 2) {
+        double f, x1, x2, r2;
+
+        do {
+            x1 = 2.0*rk_next_double(state) - 1.0;
+            x2 = 2.0*rk_next_double(state) - 1.0;
+            r2 = x1*x1 + x2*x2;
+        }
+        while (r2 >= 1.0 || r2 == 0.0);
+
+        f = sqrt(-2.0*log(r2)/r2);
+        out[i] = f*x2;
+        if (i + 1 < cnt) {
+            out[i + 1] = f*x1;
+        }
+        else {
+            state->gauss = f*x1;
+            state->has_gauss = 1;
+        }
+    }
+}
+
+void
+rk_fill_gauss_float(npy_intp cnt, float *out, rk_state *state)
+{
+    npy_intp i;
+
+    for (i = 0; i < cnt; i++) {
+        out[i] = rk_gauss_zig_float(state);
+    }
+}
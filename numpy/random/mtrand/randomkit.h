@@ -65,6 +65,36 @@
 
 #define RK_STATE_LEN 624
 
+/*
+ * Algorithms used for the normal and exponential deviates, on which the
+ * gamma and most other continuous distributions are built. RK_LEGACY keeps
+ * the streams of earlier releases reproducible.
+ */
+typedef enum {
+    RK_LEGACY = 0, /* polar Box-Muller normals, exponentials by inversion */
+    RK_ZIGGURAT = 1 /* ziggurat normals and exponentials */
+} rk_method;
+
+/*
+ * Bit generators. MT19937 keeps its state in key and pos, the others in
+ * bstate laid out as
+ *
+ *   RK_PCG64:      state_hi, state_lo, inc_hi, inc_lo
+ *   RK_PHILOX:     ctr[0..3], key[0..1], out[0..3], bpos the next out index
+ *   RK_XOSHIRO256: s[0..3]
+ *
+ * The 64 bit generators hand out 32 bit draws in halves, caching the upper
+ * half in uinteger.
+ */
+typedef enum {
+    RK_MT19937 = 0, /* Mersenne Twister, the default */
+    RK_PCG64 = 1, /* 128 bit LCG with the XSL RR output function */
+    RK_PHILOX = 2, /* Philox4x64-10 counter based generator */
+    RK_XOSHIRO256 = 3 /* xoshiro256** */
+} rk_brng;
+
+#define RK_BSTATE_LEN 10
+
 typedef struct rk_state_
 {
     unsigned long key[RK_STATE_LEN];
@@ -96,6 +126,13 @@ typedef struct rk_state_
     double p3;
     double p4;
 
+    rk_method method; /* not changed by seeding */
+
+    rk_brng brng; /* not changed by seeding */
+    npy_uint64 bstate[RK_BSTATE_LEN];
+    int bpos;
+    int has_uint32; /* !=0: uinteger contains half of a 64 bit draw */
+    npy_uint32 uinteger;
 }
 rk_state;
 
@@ -130,11 +167,30 @@ extern void rk_seed(unsigned long seed, rk_state *state);
  */
 extern rk_error rk_randomseed(rk_state *state);
 
+/*
+ * Initialize the state of the bit generator selected by state->brng from
+ * the freshly seeded MT19937 state. Called by the seeding functions.
+ */
+extern void rk_seed_brng(rk_state *state);
+
+/*
+ * Advance the bit generator far enough that the streams before and after
+ * do not overlap in practice: by 2**128 draws for MT19937 and xoshiro256**,
+ * 2**128 blocks of four draws for Philox and about 2**127.3 draws for PCG64.
+ * Cached values are discarded.
+ */
+extern void rk_jump(rk_state *state);
+
 /*
  * Returns a random unsigned long between 0 and RK_MAX inclusive
  */
 extern unsigned long rk_random(rk_state *state);
 
+/*
+ * Returns a random unsigned 64 bit integer
+ */
+extern npy_uint64 rk_uint64(rk_state *state);
+
 /*
  * Returns a random long between 0 and LONG_MAX inclusive
  */
@@ -215,10 +271,31 @@ extern rk_error rk_altfill(void *buffer, size_t size, int strong,
                             rk_state *state);
 
 /*
- * return a random gaussian deviate with variance unity and zero mean.
+ * return a random gaussian deviate with variance unity and zero mean,
+ * using the algorithm selected by state->method.
  */
 extern double rk_gauss(rk_state *state);
 
+/*
+ * Fill out with cnt values of rk_double, resp. rk_gauss, giving the same
+ * values as cnt calls of these.
+ */
+extern void rk_fill_double(npy_intp cnt, double *out, rk_state *state);
+extern void rk_fill_gauss(npy_intp cnt, double *out, rk_state *state);
+
+/*
+ * Fill out with cnt random floats between 0.0 and 1.0, 1.0 excluded, each
+ * taking the upper 24 bits of a 32 bit draw.
+ */
+extern void rk_fill_float(npy_intp cnt, float *out, rk_state *state);
+
+/*
+ * Fill out with cnt single precision gaussian deviates with variance unity
+ * and zero mean, drawn with the ziggurat method from 32 bit draws whatever
+ * the value of state->method.
+ */
+extern void rk_fill_gauss_float(npy_intp cnt, float *out, rk_state *state);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,543 @@
+/*
+ * Tables of the 256 layer ziggurat samplers of the standard normal and
+ * standard exponential distributions, see rk_gauss_zig and
+ * rk_standard_exponential_zig. Generated by generate_ziggurat.py, do not
+ * edit.
+ */
+#ifndef _RK_ZIGGURAT_
+#define _RK_ZIGGURAT_
+
+#define ZIG_NOR_R 3.654152885361009
+#define ZIG_EXP_R 7.69711747013105
+
+static const npy_uint64 zig_nor_k[256] = {
+    0xef33d8025ef64ULL, 0x0ULL, 0xc08be98fbc6b6ULL, 0xda354fabd8146ULL,
+    0xe51f67ec1eeecULL, 0xeb255e9d3f77eULL, 0xeef4b817ecab9ULL,
+    0xf19470afa44abULL, 0xf37ed61ffcb17ULL, 0xf4f469561255bULL,
+    0xf61a5e41ba396ULL, 0xf707a755396a4ULL, 0xf7cb2ec28449bULL,
+    0xf86f10c6357d2ULL, 0xf8fa6578325ddULL, 0xf9724c74dd0daULL,
+    0xf9da907dbf508ULL, 0xfa360f581fa72ULL, 0xfa86fde5b4bf8ULL,
+    0xfacf160d354dbULL, 0xfb0fb6718b90eULL, 0xfb49f8d5374c5ULL,
+    0xfb7ec2366fe77ULL, 0xfbaece9a1e50cULL, 0xfbdab9d040bedULL,
+    0xfc03060ff6c57ULL, 0xfc2821037a248ULL, 0xfc4a67ae25bd1ULL,
+    0xfc6a2977aee30ULL, 0xfc87aa92896a4ULL, 0xfca325e4bde85ULL,
+    0xfcbcce902231aULL, 0xfcd4d12f839c4ULL, 0xfceb54d8fec99ULL,
+    0xfd007bf1dc930ULL, 0xfd1464dd6c4e5ULL, 0xfd272a8e2f450ULL,
+    0xfd38e4ff0c91eULL, 0xfd49a9990b479ULL, 0xfd598b8920f52ULL,
+    0xfd689c08e99ecULL, 0xfd76ea9c8e832ULL, 0xfd848547b08e8ULL,
+    0xfd9178bad2c8bULL, 0xfd9dd07a7add2ULL, 0xfda9970105e8bULL,
+    0xfdb4d5dc02e1fULL, 0xfdbf95c5bfcd0ULL, 0xfdc9debb99a7dULL,
+    0xfdd3b8118729dULL, 0xfddd288342f8fULL, 0xfde6364369f63ULL,
+    0xfdeee708d514eULL, 0xfdf7401a6b42eULL, 0xfdff46599ed3eULL,
+    0xfe06fe4bc24f1ULL, 0xfe0e6c225a258ULL, 0xfe1593c28b84bULL,
+    0xfe1c78cbc3f98ULL, 0xfe231e9db1ca9ULL, 0xfe29885da1b91ULL,
+    0xfe2fb8fb54186ULL, 0xfe35b33558d4aULL, 0xfe3b799d0002aULL,
+    0xfe410e99ead7eULL, 0xfe46746d47734ULL, 0xfe4bad34c095bULL,
+    0xfe50baed29524ULL, 0xfe559f74ebc77ULL, 0xfe5a5c8e41212ULL,
+    0xfe5ef3e138689ULL, 0xfe6366fd91077ULL, 0xfe67b75c6d578ULL,
+    0xfe6be661e11aaULL, 0xfe6ff55e5f4f2ULL, 0xfe73e5900a701ULL,
+    0xfe77b823e9e39ULL, 0xfe7b6e37070a1ULL, 0xfe7f08d774242ULL,
+    0xfe8289053f08cULL, 0xfe85efb35173bULL, 0xfe893dc840864ULL,
+    0xfe8c741f0cebcULL, 0xfe8f9387d4ef6ULL, 0xfe929cc879b1cULL,
+    0xfe95909d388eaULL, 0xfe986fb939aa1ULL, 0xfe9b3ac714865ULL,
+    0xfe9df2694b6d5ULL, 0xfea0973abe67bULL, 0xfea329cf166a4ULL,
+    0xfea5aab32952cULL, 0xfea81a6d57419ULL, 0xfeaa797de1cefULL,
+    0xfeacc85f3d91fULL, 0xfeaf07865e63cULL, 0xfeb13762fec12ULL,
+    0xfeb3585fe2a4aULL, 0xfeb56ae3162b4ULL, 0xfeb76f4e284f9ULL,
+    0xfeb965fe62013ULL, 0xfebb4f4cf9d7cULL, 0xfebd2b8f449cfULL,
+    0xfebefb16e2e3dULL, 0xfec0be31ebde8ULL, 0xfec2752b15a14ULL,
+    0xfec42049dafd3ULL, 0xfec5bfd29f196ULL, 0xfec75406ceef4ULL,
+    0xfec8dd2500cb4ULL, 0xfeca5b6911f10ULL, 0xfecbcf0c427feULL,
+    0xfecd38454fb15ULL, 0xfece97488c8b3ULL, 0xfecfec47f91b7ULL,
+    0xfed1377358528ULL, 0xfed278f844903ULL, 0xfed3b10242f4cULL,
+    0xfed4dfbad586dULL, 0xfed605498c3dcULL, 0xfed721d414fe8ULL,
+    0xfed8357e4a981ULL, 0xfed9406a42cc8ULL, 0xfeda42b85b704ULL,
+    0xfedb3c8746ab3ULL, 0xfedc2df416652ULL, 0xfedd171a46e52ULL,
+    0xfeddf813c8ad2ULL, 0xfeded0f90997fULL, 0xfedfa1e0fd413ULL,
+    0xfee06ae124bc4ULL, 0xfee12c0d95a06ULL, 0xfee1e579006dfULL,
+    0xfee29734b6524ULL, 0xfee34150ae4bbULL, 0xfee3e3db89b3cULL,
+    0xfee47ee2982f3ULL, 0xfee51271db086ULL, 0xfee59e9407f41ULL,
+    0xfee623528b42dULL, 0xfee6a0b5897f0ULL, 0xfee716c3e077aULL,
+    0xfee7858327b81ULL, 0xfee7ecf7b06b9ULL, 0xfee84d2484ab2ULL,
+    0xfee8a60b66342ULL, 0xfee8f7accc851ULL, 0xfee94207e25daULL,
+    0xfee9851a829ebULL, 0xfee9c0e13485bULL, 0xfee9f557273f3ULL,
+    0xfeea22762ccaeULL, 0xfeea4836b42abULL, 0xfeea668fc2d71ULL,
+    0xfeea7d76ed6f9ULL, 0xfeea8ce04fa0aULL, 0xfeea94be8333bULL,
+    0xfeea95029640fULL, 0xfeea8d9c0075dULL, 0xfeea7e7897653ULL,
+    0xfeea678481d24ULL, 0xfeea48aa29e82ULL, 0xfeea21d22e4d9ULL,
+    0xfee9f2e352024ULL, 0xfee9bbc26af2eULL, 0xfee97c524f2e3ULL,
+    0xfee93473c0a39ULL, 0xfee8e40557515ULL, 0xfee88ae369c79ULL,
+    0xfee828e7f3dfcULL, 0xfee7bdea7b887ULL, 0xfee749bff37ffULL,
+    0xfee6cc3a9bd5eULL, 0xfee64529e007fULL, 0xfee5b45a32888ULL,
+    0xfee51994e57b5ULL, 0xfee474a0006ceULL, 0xfee3c53e12c4fULL,
+    0xfee30b2e02ad7ULL, 0xfee2462ad8204ULL, 0xfee175eb83c59ULL,
+    0xfee09a22a1447ULL, 0xfedfb27e349cbULL, 0xfedebea76216cULL,
+    0xfeddbe422047dULL, 0xfedcb0ece39d3ULL, 0xfedb964042cf3ULL,
+    0xfeda6dce938c9ULL, 0xfed937237e98cULL, 0xfed7f1c38a836ULL,
+    0xfed69d2b9c02aULL, 0xfed538d06adffULL, 0xfed3c41dea422ULL,
+    0xfed23e76a2fd7ULL, 0xfed0a732fe643ULL, 0xfecefda07fe33ULL,
+    0xfecd4100eb7b8ULL, 0xfecb708956eb4ULL, 0xfec98b61230c0ULL,
+    0xfec790a0da978ULL, 0xfec57f50f31fdULL, 0xfec356686c961ULL,
+    0xfec114cb4b334ULL, 0xfebeb948e6fd0ULL, 0xfebc429a0b691ULL,
+    0xfeb9af5ee0cdcULL, 0xfeb6fe1c98542ULL, 0xfeb42d3ad1f9eULL,
+    0xfeb13b00b2d4bULL, 0xfeae2591a02e8ULL, 0xfeaaeae992256ULL,
+    0xfea788d8ee326ULL, 0xfea3fcffd73e5ULL, 0xfea044c8dd9f6ULL,
+    0xfe9c5d62f563aULL, 0xfe9843ba947a3ULL, 0xfe93f471d4728ULL,
+    0xfe8f6bd76c5d6ULL, 0xfe8aa5dc4e8e6ULL, 0xfe859e07ab1eaULL,
+    0xfe804f690a93fULL, 0xfe7ab488233bfULL, 0xfe74c751f6aa5ULL,
+    0xfe6e8102aa201ULL, 0xfe67da0b6abd8ULL, 0xfe60c9f38307dULL,
+    0xfe5947338f742ULL, 0xfe51470977280ULL, 0xfe48bd436f457ULL,
+    0xfe3f9bffd1e37ULL, 0xfe35d35eeb19bULL, 0xfe2b5122fe4fdULL,
+    0xfe20003995557ULL, 0xfe13c82788314ULL, 0xfe068c4ee67afULL,
+    0xfdf82b02b71aaULL, 0xfde87c57efeaaULL, 0xfdd7509c63bfdULL,
+    0xfdc46e529bf12ULL, 0xfdaf8f82e0282ULL, 0xfd985e1b2ba75ULL,
+    0xfd7e6ef48cf04ULL, 0xfd613adbd650bULL, 0xfd40149e2f011ULL,
+    0xfd1a1a7b4c7acULL, 0xfcee204761f9eULL, 0xfcba8d85e11b1ULL,
+    0xfc7d26ecd2d22ULL, 0xfc32b2f1e22ecULL, 0xfbd6581c0b839ULL,
+    0xfb606c4005433ULL, 0xfac40582a2873ULL, 0xf9e971e014597ULL,
+    0xf89fa48a41dfbULL, 0xf66c5f7f0302cULL, 0xf1a5a4b331c49ULL
+};
+
+static const double zig_nor_w[256] = {
+    8.683627060801316e-16, 4.779330175727775e-17, 6.354352417405286e-17,
+    7.454870481247716e-17, 8.329366815793118e-17, 9.068060405059501e-17,
+    9.714860076567782e-17, 1.0294750314241035e-16, 1.0823430288447701e-16,
+    1.1311470196109048e-16, 1.1766359457022938e-16, 1.2193617278714378e-16,
+    1.2597439914637105e-16, 1.2981099886264044e-16, 1.3347203736824135e-16,
+    1.3697864842571216e-16, 1.4034823001242394e-16, 1.4359529452056958e-16,
+    1.4673208742364434e-16, 1.4976904668391052e-16, 1.5271515003596215e-16,
+    1.555781816946078e-16, 1.5836494009290903e-16, 1.6108140175274945e-16,
+    1.637328520396987e-16, 1.663239905842085e-16, 1.688590170867661e-16,
+    1.7134170176559673e-16, 1.7377544365864874e-16, 1.761633192300101e-16,
+    1.7850812316976745e-16, 1.8081240285799165e-16, 1.8307848764826765e-16,
+    1.8530851388618034e-16, 1.8750444639373896e-16, 1.8966809700774774e-16,
+    1.9180114064838635e-16, 1.939051293062512e-16, 1.9598150426628837e-16,
+    1.9803160683128186e-16, 2.000566877627334e-16, 2.0205791562071661e-16,
+    2.0403638415480222e-16, 2.0599311887403719e-16, 2.0792908290414027e-16,
+    2.0984518222370362e-16, 2.1174227035760352e-16, 2.1362115259449878e-16,
+    2.1548258978581468e-16, 2.1732730177564377e-16, 2.191559705042728e-16,
+    2.209692428223533e-16, 2.2276773304789563e-16, 2.245520252941437e-16,
+    2.2632267559285693e-16, 2.280802138345019e-16, 2.2982514554424704e-16,
+    2.315579535104082e-16, 2.3327909928004376e-16, 2.3498902453470975e-16,
+    2.366881523579162e-16, 2.383768884045426e-16, 2.4005562198135073e-16,
+    2.4172472704675035e-16, 2.4338456313711043e-16, 2.450354762261497e-16,
+    2.466777995232707e-16, 2.483118542161089e-16, 2.4993795016204544e-16,
+    2.5155638653296593e-16, 2.5316745241713597e-16, 2.5477142738169457e-16,
+    2.563685819989398e-16, 2.579591783392868e-16, 2.595434704335171e-16,
+    2.611217047067021e-16, 2.6269412038597266e-16, 2.642609498841191e-16,
+    2.6582241916083083e-16, 2.673787480632365e-16, 2.689301506472617e-16,
+    2.704768354811996e-16, 2.7201900593277335e-16, 2.7355686044086806e-16,
+    2.750905927730168e-16, 2.7662039226963913e-16, 2.781464440759545e-16,
+    2.796689293624231e-16, 2.8118802553450217e-16, 2.82703906432448e-16,
+    2.842167425218407e-16, 2.857267010754602e-16, 2.8723394634709804e-16,
+    2.8873863973784824e-16, 2.902409399553843e-16, 2.917410031666946e-16,
+    2.9323898314471826e-16, 2.9473503140929354e-16, 2.962292973628067e-16,
+    2.9772192842090294e-16, 2.9921307013860136e-16, 3.0070286633213315e-16,
+    3.0219145919680625e-16, 3.0367898942118023e-16, 3.0516559629782197e-16,
+    3.0665141783089555e-16, 3.081365908408298e-16, 3.0962125106629235e-16,
+    3.111055332636894e-16, 3.125895713044e-16, 3.140734982699447e-16,
+    3.1555744654528016e-16, 3.1704154791040295e-16, 3.1852593363044075e-16,
+    3.200107345444012e-16, 3.2149608115274475e-16, 3.229821037039416e-16,
+    3.2446893228016983e-16, 3.259566968823079e-16, 3.274455275143707e-16,
+    3.28935554267537e-16, 3.304269074039129e-16, 3.3191971744017523e-16,
+    3.3341411523123725e-16, 3.349102320540779e-16, 3.3640819969187656e-16,
+    3.3790815051859503e-16, 3.39410217584149e-16, 3.4091453470031265e-16,
+    3.4242123652750187e-16, 3.439304586625832e-16, 3.4544233772785845e-16,
+    3.4695701146137845e-16, 3.4847461880874147e-16, 3.499953000165382e-16,
+    3.515191967276075e-16, 3.5304645207827406e-16, 3.5457721079774367e-16,
+    3.5611161930983894e-16, 3.5764982583726515e-16, 3.5919198050860314e-16,
+    3.607382354682353e-16, 3.6228874498941935e-16, 3.638436655907346e-16,
+    3.6540315615613714e-16, 3.6696737805887024e-16, 3.685364952894915e-16,
+    3.7011067458828993e-16, 3.7169008558238235e-16, 3.7327490092779445e-16,
+    3.748652964568489e-16, 3.764614513312029e-16, 3.780635482008961e-16,
+    3.7967177336979448e-16, 3.812863169678378e-16, 3.8290737313052437e-16,
+    3.8453514018609596e-16, 3.8616982085091493e-16, 3.8781162243355867e-16,
+    3.894607570481926e-16, 3.9111744183782054e-16, 3.927818992080542e-16,
+    3.944543570720877e-16, 3.9613504910761354e-16, 3.9782421502646826e-16,
+    3.995221008578565e-16, 4.012289592460629e-16, 4.029450497636328e-16,
+    4.04670639241075e-16, 4.0640600211422504e-16, 4.0815142079049387e-16,
+    4.099071860353266e-16, 4.1167359738030247e-16, 4.134509635544235e-16,
+    4.152396029402687e-16, 4.1703984405683144e-16, 4.188520260710111e-16,
+    4.206764993399014e-16, 4.2251362598620484e-16, 4.2436378050930775e-16,
+    4.262273504347798e-16, 4.2810473700531167e-16, 4.2999635591638323e-16,
+    4.3190263810026294e-16, 4.338240305622791e-16, 4.357609972736849e-16,
+    4.3771402012585875e-16, 4.3968359995105214e-16, 4.4167025761542035e-16,
+    4.4367453519065673e-16, 4.456969972112043e-16, 4.477382320247534e-16,
+    4.49798853244555e-16, 4.518795013130059e-16, 4.539808451870034e-16,
+    4.561035841567423e-16, 4.582484498109568e-16, 4.604162081631154e-16,
+    4.626076619547847e-16, 4.648236531543208e-16, 4.670650656712633e-16,
+    4.69332828309333e-16, 4.716279179838353e-16, 4.739513632325869e-16,
+    4.763042480533139e-16, 4.786877161048725e-16, 4.811029753147419e-16,
+    4.835513029411527e-16, 4.860340511450813e-16, 4.885526531353604e-16,
+    4.911086299595271e-16, 4.937035980240336e-16, 4.963392774403987e-16,
+    4.990175013091822e-16, 5.01740226071809e-16, 5.045095430818728e-16,
+    5.073276915733542e-16, 5.101970732341562e-16, 5.131202686306784e-16,
+    5.161000557743228e-16, 5.1913943117577e-16, 5.222416338000234e-16,
+    5.254101724177597e-16, 5.286488569504945e-16, 5.3196183453384e-16,
+    5.353536311816497e-16, 5.388292001334053e-16, 5.423939782201712e-16,
+    5.46053951907478e-16, 5.498157350892814e-16, 5.536866612467876e-16,
+    5.576748932926577e-16, 5.617895553555417e-16, 5.660408920082423e-16,
+    5.70440462129139e-16, 5.750013768919896e-16, 5.797385945724595e-16,
+    5.84669289345548e-16, 5.8981331764779e-16, 5.951938149641445e-16,
+    6.008379696271908e-16, 6.067780409333449e-16, 6.130527208725281e-16,
+    6.197089894581626e-16, 6.268046963301283e-16, 6.344122407127505e-16,
+    6.426239659548054e-16, 6.515603317344993e-16, 6.613827885097663e-16,
+    6.723150462505586e-16, 6.846803417564259e-16, 6.98971833638762e-16,
+    7.159994934830664e-16, 7.372424301798798e-16, 7.658936370805572e-16,
+    8.113849337656484e-16
+};
+
+static const double zig_nor_f[256] = {
+    1.0, 0.9771017012676713, 0.9598790918001063, 0.9451989534422993,
+    0.9320600759592301, 0.9199915050393467, 0.9087264400521305,
+    0.8980959218983431, 0.887984660755833, 0.8783096558089171,
+    0.8690086880368567, 0.8600336211963312, 0.8513462584586777,
+    0.842915653112204, 0.8347162929868831, 0.826726833946221,
+    0.818929191603702, 0.8113078743126559, 0.8038494831709639,
+    0.7965423304229586, 0.7893761435660241, 0.7823418326548021,
+    0.7754313049811867, 0.7686373157984858, 0.7619533468367949,
+    0.7553735065070958, 0.7488924472191565, 0.7425052963401507,
+    0.7362075981268622, 0.7299952645614758, 0.7238645334686298,
+    0.7178119326307216, 0.7118342488782481, 0.7059285013327539,
+    0.7000919181365113, 0.6943219161261164, 0.6886160830046714,
+    0.6829721616449944, 0.6773880362187731, 0.6718617198970818,
+    0.6663913439087499, 0.6609751477766629, 0.655611470579697,
+    0.6502987431108165, 0.6450354808208221, 0.6398202774530563,
+    0.6346517992876233, 0.6295287799248364, 0.6244500155470262,
+    0.6194143606058341, 0.6144207238889136, 0.6094680649257731,
+    0.6045553906974674, 0.5996817526191249, 0.594846243767987,
+    0.5900479963328255, 0.5852861792633709, 0.5805599961007905,
+    0.5758686829723533, 0.5712115067352528, 0.566587763256164,
+    0.561996775814524, 0.5574378936187656, 0.552910490425832,
+    0.5484139632552655, 0.5439477311900258, 0.5395112342569517,
+    0.5351039323804572, 0.5307253044036616, 0.526374847171684,
+    0.5220520746723215, 0.5177565172297559, 0.5134877207473266,
+    0.5092452459957476, 0.5050286679434679, 0.5008375751261485,
+    0.4966715690524894, 0.4925302636438682, 0.48841328470545764,
+    0.48432026942668294, 0.4802508659090465, 0.47620473271950553,
+    0.4721815384677298, 0.46818096140569326, 0.46420268904817397,
+    0.46024641781284253, 0.45631185267871616, 0.4523987068618483,
+    0.4485067015072028, 0.4446355653957392, 0.4407850346658038,
+    0.4369548525479854, 0.43314476911265215, 0.4293545410294413,
+    0.42558393133802186, 0.4218327092294958, 0.418100649837848,
+    0.41438753404089096, 0.41069314827018805, 0.4070172843294732,
+    0.40335973922111434, 0.39972031498019706, 0.39609881851583223,
+    0.3924950614593154, 0.3889088600187886, 0.3853400348400771,
+    0.38178841087339344, 0.37825381724561896, 0.3747360871378909,
+    0.3712350576682393, 0.3677505697790323, 0.3642824681290038,
+    0.3608306009896478, 0.3573948201457803, 0.3539749808000766,
+    0.35057094148140594, 0.34718256395679353, 0.3438097131468506,
+    0.3404522570445217, 0.33711006663700593, 0.3337830158307183,
+    0.3304709813791634, 0.32717384281360135, 0.32389148237639104,
+    0.32062378495690536, 0.3173706380299135, 0.3141319315963371,
+    0.31090755812628634, 0.30769741250429195, 0.3045013919766498,
+    0.30131939610080294, 0.29815132669668537, 0.2949970877999617,
+    0.29185658561709504, 0.28872972848218276, 0.2856164268155016,
+    0.28251659308370747, 0.2794301417616378, 0.2763569892956681,
+    0.2732970540685769, 0.27025025636587524, 0.26721651834356114,
+    0.2641957639972608, 0.2611879191327209, 0.25819291133761896,
+    0.2552106699546617, 0.25224112605594196, 0.24928421241852827,
+    0.24633986350126366, 0.24340801542275015, 0.24048860594050042,
+    0.23758157443123798, 0.2346868618723299, 0.2318044108243386,
+    0.22893416541468026, 0.22607607132238022, 0.22323007576391746,
+    0.22039612748015197, 0.21757417672433116, 0.2147641752511736,
+    0.21196607630703018, 0.20917983462112502, 0.20640540639788074,
+    0.20364274931033488, 0.2008918224946566, 0.19815258654577514,
+    0.19542500351413428, 0.19270903690358915, 0.19000465167046499,
+    0.18731181422380028, 0.18463049242679927, 0.18196065559952257,
+    0.17930227452284767, 0.176655321443735, 0.17401977008183878,
+    0.17139559563750595, 0.1687827748012115, 0.16618128576448207,
+    0.16359110823236572, 0.1610122234375111, 0.1584446141559243,
+    0.15588826472447923, 0.15334316106026286, 0.1508092906818457,
+    0.14828664273257455, 0.14577520800599406, 0.14327497897351343,
+    0.1407859498144447, 0.13830811644855073, 0.13584147657125373,
+    0.13338602969166913, 0.13094177717364433, 0.12850872227999954,
+    0.12608687022018586, 0.12367622820159656, 0.12127680548479022,
+    0.11888861344290999, 0.11651166562561081, 0.11414597782783836,
+    0.111791568163838, 0.10944845714681165, 0.10711666777468365,
+    0.1047962256224869, 0.10248715894193508, 0.10018949876880982,
+    0.0979032790388623, 0.09562853671300883, 0.09336531191269087,
+    0.09111364806637363, 0.0888735920682758, 0.08664519445055796,
+    0.08442850957035337, 0.08222359581320286, 0.08003051581466306,
+    0.07784933670209605, 0.07568013035892708, 0.07352297371398127,
+    0.07137794905889037, 0.06924514439700677, 0.0671246538277885,
+    0.06501657797124286, 0.06292102443775813, 0.060838108349539864,
+    0.058767952920933765, 0.0567106901062029, 0.05466646132488892,
+    0.05263541827679218, 0.05061772386094777, 0.04861355321586853,
+    0.04662309490193037, 0.04464655225129445, 0.04268414491647444,
+    0.04073611065594093, 0.03880270740452612, 0.03688421568856729,
+    0.034980941461716084, 0.03309321945857852, 0.03122141719192025,
+    0.029365939758133317, 0.027527235669603085, 0.025705804008548896,
+    0.023902203305795882, 0.022117062707308868, 0.02035109623004452,
+    0.018605121275724647, 0.01688008315254317, 0.015177088307935327,
+    0.01349745060173988, 0.01184275785790789, 0.010214971439701471,
+    0.008616582769398732, 0.007050875471373227, 0.005522403299250997,
+    0.0040379725933630305, 0.0026090727461021627, 0.0012602859304985975
+};
+
+static const npy_uint64 zig_exp_k[256] = {
+    0x1c5214272497c7ULL, 0x0ULL, 0x137d5bd79c3182ULL, 0x186ef58e3f3c11ULL,
+    0x1a9bb7320eb0aeULL, 0x1bd127f719447dULL, 0x1c951d0f88651bULL,
+    0x1d1bfe2d5c3973ULL, 0x1d7e5bd56b18b3ULL, 0x1dc934dd172c71ULL,
+    0x1e0409dfac9dcaULL, 0x1e337b71d47837ULL, 0x1e5a8b177cb7a3ULL,
+    0x1e7b42096f046cULL, 0x1e970daf08ae3eULL, 0x1eaef5b14ef09eULL,
+    0x1ec3bd07b46557ULL, 0x1ed5f6f08799ceULL, 0x1ee614ae6e5688ULL,
+    0x1ef46eca361cd0ULL, 0x1f014b76ddd4a4ULL, 0x1f0ce313a796b7ULL,
+    0x1f176369f1f77aULL, 0x1f20f20c452571ULL, 0x1f29ae1951a874ULL,
+    0x1f31b18fb95532ULL, 0x1f39125157c106ULL, 0x1f3fe2eb6e694cULL,
+    0x1f463332d788fbULL, 0x1f4c10bf1d3a0fULL, 0x1f51874c5c3322ULL,
+    0x1f56a109c3ecc0ULL, 0x1f5b66d9099996ULL, 0x1f5fe08210d08cULL,
+    0x1f6414dd445772ULL, 0x1f6809f6859679ULL, 0x1f6bc52a2b02e7ULL,
+    0x1f6f4b3d32e4f4ULL, 0x1f72a07190f13aULL, 0x1f75c8974d09d7ULL,
+    0x1f78c71b045cc0ULL, 0x1f7b9f12413ff5ULL, 0x1f7e5346079f8aULL,
+    0x1f80e63be21139ULL, 0x1f835a3dad9162ULL, 0x1f85b16056b913ULL,
+    0x1f87ed89b24262ULL, 0x1f8a10759374faULL, 0x1f8c1bba3d39adULL,
+    0x1f8e10cc45d04aULL, 0x1f8ff102013e17ULL, 0x1f91bd968358e1ULL,
+    0x1f9377ac47afd8ULL, 0x1f95204f8b64dbULL, 0x1f96b878633892ULL,
+    0x1f98410c968892ULL, 0x1f99bae146ba81ULL, 0x1f9b26bc697f00ULL,
+    0x1f9c85561b717aULL, 0x1f9dd759cfd803ULL, 0x1f9f1d6761a1ceULL,
+    0x1fa058140936c0ULL, 0x1fa187eb3a3339ULL, 0x1fa2ad6f6bc4fcULL,
+    0x1fa3c91ace0683ULL, 0x1fa4db5fee6aa3ULL, 0x1fa5e4aa4d097dULL,
+    0x1fa6e55ee46783ULL, 0x1fa7dddca51ec4ULL, 0x1fa8ce7ce6a875ULL,
+    0x1fa9b793ce5fefULL, 0x1faa9970adb858ULL, 0x1fab745e588232ULL,
+    0x1fac48a3740585ULL, 0x1fad1682bf9fe9ULL, 0x1fadde3b5782c1ULL,
+    0x1faea008f21d6dULL, 0x1faf5c2418b07eULL, 0x1fb012c25b7a13ULL,
+    0x1fb0c41681dff4ULL, 0x1fb17050b6f1fbULL, 0x1fb2179eb2963aULL,
+    0x1fb2ba2bdfa84bULL, 0x1fb358217f4e18ULL, 0x1fb3f1a6c9be0cULL,
+    0x1fb486e10cacd7ULL, 0x1fb517f3c793fdULL, 0x1fb5a500c5fdaaULL,
+    0x1fb62e2837fe59ULL, 0x1fb6b388c9010aULL, 0x1fb7353fb50799ULL,
+    0x1fb7b368dc7da8ULL, 0x1fb82e1ed6ba09ULL, 0x1fb8a57b0347f6ULL,
+    0x1fb919959a0f74ULL, 0x1fb98a85ba7204ULL, 0x1fb9f861796f27ULL,
+    0x1fba633deee286ULL, 0x1fbacb2f41ec17ULL, 0x1fbb3048b49145ULL,
+    0x1fbb929caea4e2ULL, 0x1fbbf23cc8029eULL, 0x1fbc4f39d22995ULL,
+    0x1fbca9a3e140d5ULL, 0x1fbd018a548f9fULL, 0x1fbd56fbde729cULL,
+    0x1fbdaa068bd66bULL, 0x1fbdfab7cb3f41ULL, 0x1fbe491c7364deULL,
+    0x1fbe9540c9695fULL, 0x1fbedf3086b128ULL, 0x1fbf26f6de6175ULL,
+    0x1fbf6c9e828ae3ULL, 0x1fbfb031a904c4ULL, 0x1fbff1ba0ffdb0ULL,
+    0x1fc03141024589ULL, 0x1fc06ecf5b54b3ULL, 0x1fc0aa6d8b1427ULL,
+    0x1fc0e42399698aULL, 0x1fc11bf9298a64ULL, 0x1fc151f57d1943ULL,
+    0x1fc1861f770f4bULL, 0x1fc1b87d9e74b4ULL, 0x1fc1e91620ea43ULL,
+    0x1fc217eed505deULL, 0x1fc2450d3c83ffULL, 0x1fc27076864fc2ULL,
+    0x1fc29a2f90630fULL, 0x1fc2c23ce98046ULL, 0x1fc2e8a2d2c6b4ULL,
+    0x1fc30d654122edULL, 0x1fc33087de9c0fULL, 0x1fc3520e0b7ec7ULL,
+    0x1fc371fadf66f8ULL, 0x1fc390512a2887ULL, 0x1fc3ad137497faULL,
+    0x1fc3c844013349ULL, 0x1fc3e1e4ccab40ULL, 0x1fc3f9f78e4da8ULL,
+    0x1fc4107db85061ULL, 0x1fc4257877fd68ULL, 0x1fc438e8b5bfc7ULL,
+    0x1fc44acf15112aULL, 0x1fc45b2bf447e8ULL, 0x1fc469ff6c4504ULL,
+    0x1fc477495001b2ULL, 0x1fc483092bfbb9ULL, 0x1fc48d3e457ff6ULL,
+    0x1fc495e799d21bULL, 0x1fc49d03dd30b1ULL, 0x1fc4a29179b433ULL,
+    0x1fc4a68e8e07fcULL, 0x1fc4a8f8ebfb8cULL, 0x1fc4a9ce16ea9fULL,
+    0x1fc4a90b41fa34ULL, 0x1fc4a6ad4e28a0ULL, 0x1fc4a2b0c82e75ULL,
+    0x1fc49d11e62de3ULL, 0x1fc495cc852df5ULL, 0x1fc48cdc265ec1ULL,
+    0x1fc4823bec237aULL, 0x1fc475e696dee6ULL, 0x1fc467d6817e83ULL,
+    0x1fc458059dc037ULL, 0x1fc4466d702e21ULL, 0x1fc433070bcb99ULL,
+    0x1fc41dcb0d6e0eULL, 0x1fc406b196bbf7ULL, 0x1fc3edb248cb62ULL,
+    0x1fc3d2c43e593cULL, 0x1fc3b5de0591b4ULL, 0x1fc396f599614cULL,
+    0x1fc376005a4593ULL, 0x1fc352f3069371ULL, 0x1fc32dc1b22819ULL,
+    0x1fc3065fbd7888ULL, 0x1fc2dcbfcbf263ULL, 0x1fc2b0d3b99f9eULL,
+    0x1fc2828c8ffcf0ULL, 0x1fc251da79f164ULL, 0x1fc21eacb6d39eULL,
+    0x1fc1e8f18c6756ULL, 0x1fc1b09637bb3cULL, 0x1fc17586dccd10ULL,
+    0x1fc137ae74d6b7ULL, 0x1fc0f6f6bb2415ULL, 0x1fc0b348184da4ULL,
+    0x1fc06c898baff1ULL, 0x1fc022a092f365ULL, 0x1fbfd5710f72b9ULL,
+    0x1fbf84dd29488fULL, 0x1fbf30c52fc60bULL, 0x1fbed907770cc6ULL,
+    0x1fbe7d80327ddbULL, 0x1fbe1e094ba614ULL, 0x1fbdba7a354408ULL,
+    0x1fbd52a7b9f826ULL, 0x1fbce663c6201bULL, 0x1fbc757d2c4de5ULL,
+    0x1fbbffbf63b7aaULL, 0x1fbb84f23fe6a2ULL, 0x1fbb04d9a0d18dULL,
+    0x1fba7f351a70adULL, 0x1fb9f3bf92b619ULL, 0x1fb9622ed4abfcULL,
+    0x1fb8ca33174a17ULL, 0x1fb82b76765b54ULL, 0x1fb7859c5b895cULL,
+    0x1fb6d840d55594ULL, 0x1fb622f7d96943ULL, 0x1fb5654c6f37e1ULL,
+    0x1fb49ebfbf69d2ULL, 0x1fb3cec803e747ULL, 0x1fb2f4cf539c3fULL,
+    0x1fb21032442853ULL, 0x1fb1203e5a9604ULL, 0x1fb0243042e1c2ULL,
+    0x1faf1b31c479a7ULL, 0x1fae045767e105ULL, 0x1facde9dbf2d73ULL,
+    0x1faba8e640060bULL, 0x1faa61f399ff28ULL, 0x1fa908656f66a2ULL,
+    0x1fa79ab3508d3dULL, 0x1fa61726d1f214ULL, 0x1fa47bd48bea00ULL,
+    0x1fa2c693c5c095ULL, 0x1fa0f4f47df315ULL, 0x1f9f04336bbe0bULL,
+    0x1f9cf12b79f9bdULL, 0x1f9ab84415abc5ULL, 0x1f98555b782fb9ULL,
+    0x1f95c3abd03f79ULL, 0x1f92fda9cef1f3ULL, 0x1f8ffcda9ae41dULL,
+    0x1f8cb99e7385f8ULL, 0x1f892aec479607ULL, 0x1f8545f904db8fULL,
+    0x1f80fdc336039bULL, 0x1f7c427839e926ULL, 0x1f7700a3582accULL,
+    0x1f71200f1a241cULL, 0x1f6a8234b7352bULL, 0x1f630000a8e267ULL,
+    0x1f5a66904fe3c4ULL, 0x1f50724ece1172ULL, 0x1f44c7665c6fdbULL,
+    0x1f36e5a38a59a2ULL, 0x1f26143450340aULL, 0x1f113e047b0414ULL,
+    0x1ef6aefa57cbe7ULL, 0x1ed38ca188151eULL, 0x1ea2a61e122db1ULL,
+    0x1e5961c78b267cULL, 0x1dddf62bac0bb1ULL, 0x1cdb4dd9e4e8c0ULL
+};
+
+static const double zig_exp_w[256] = {
+    9.655740063209183e-16, 7.08901424395542e-18, 1.1639412496691228e-17,
+    1.5243915123532163e-17, 1.8332848857237445e-17, 2.108965109464487e-17,
+    2.3611280778431385e-17, 2.5955957723108943e-17, 2.8161735541977523e-17,
+    3.0255041303213823e-17, 3.225508254836375e-17, 3.417632340185027e-17,
+    3.602996978734453e-17, 3.7824907768696497e-17, 3.956832198097554e-17,
+    4.126611778175947e-17, 4.2923218084425256e-17, 4.4543777432823714e-17,
+    4.6131339814831865e-17, 4.768895725264636e-17, 4.921928043727963e-17,
+    5.072462904503147e-17, 5.220704702792672e-17, 5.366834661718192e-17,
+    5.511014372835095e-17, 5.653388673239667e-17, 5.794088004852767e-17,
+    5.933230365208943e-17, 6.07092293284718e-17, 6.207263431163193e-17,
+    6.342341280303078e-17, 6.476238575956142e-17, 6.609030925769405e-17,
+    6.740788167872723e-17, 6.871574991183812e-17, 7.001451473403931e-17,
+    7.130473549660643e-17, 7.258693422414648e-17, 7.386159921381792e-17,
+    7.512918820723728e-17, 7.639013119550826e-17, 7.764483290797848e-17,
+    7.88936750272979e-17, 8.013701816675454e-17, 8.137520364041762e-17,
+    8.260855505210038e-17, 8.383737972539139e-17, 8.506196999385323e-17,
+    8.628260436784113e-17, 8.749954859216183e-17, 8.871305660690252e-17,
+    8.992337142215357e-17, 9.113072591597909e-17, 9.233534356381788e-17,
+    9.353743910649129e-17, 9.473721916312951e-17, 9.593488279457999e-17,
+    9.713062202221521e-17, 9.832462230649511e-17, 9.951706298915072e-17,
+    1.0070811770242949e-16, 1.0189795474846941e-16, 1.030867374515422e-16,
+    1.0427462448561886e-16, 1.0546177017945764e-16, 1.0664832480119147e-16,
+    1.0783443482419486e-16, 1.0902024317583505e-16, 1.1020588947055781e-16,
+    1.1139151022861975e-16, 1.1257723908165675e-16, 1.1376320696616847e-16,
+    1.1494954230590093e-16, 1.1613637118402183e-16, 1.1732381750590458e-16,
+    1.1851200315326694e-16, 1.1970104813034652e-16, 1.2089107070273855e-16,
+    1.2208218752947062e-16, 1.2327451378884152e-16, 1.2446816329851125e-16,
+    1.2566324863028985e-16, 1.2685988122003975e-16, 1.2805817147307494e-16,
+    1.2925822886541196e-16, 1.3046016204120288e-16, 1.3166407890665726e-16,
+    1.328700867207381e-16, 1.3407829218289994e-16, 1.3528880151811755e-16,
+    1.3650172055943978e-16, 1.3771715482828812e-16, 1.389352096127064e-16,
+    1.4015599004375715e-16, 1.4137960117024852e-16, 1.4260614803196654e-16,
+    1.4383573573157902e-16, 1.4506846950536877e-16, 1.4630445479294757e-16,
+    1.4754379730609516e-16, 1.487866030968626e-16, 1.500329786250737e-16,
+    1.5128303082535394e-16, 1.5253686717381255e-16, 1.537945957544997e-16,
+    1.5505632532575771e-16, 1.5632216538658375e-16, 1.5759222624311761e-16,
+    1.5886661907536842e-16, 1.6014545600429167e-16, 1.6142885015932787e-16,
+    1.6271691574651305e-16, 1.640097681172718e-16, 1.653075238380037e-16,
+    1.666103007605742e-16, 1.6791821809382289e-16, 1.6923139647620223e-16,
+    1.7054995804966298e-16, 1.7187402653490317e-16, 1.7320372730810084e-16,
+    1.745391874792534e-16, 1.7588053597224914e-16, 1.7722790360680065e-16,
+    1.7858142318237326e-16, 1.7994122956424637e-16, 1.8130745977185016e-16,
+    1.8268025306952523e-16, 1.8405975105985878e-16, 1.8544609777975695e-16,
+    1.8683943979941927e-16, 1.882399263243892e-16, 1.8964770930086167e-16,
+    1.9106294352443765e-16, 1.9248578675252438e-16, 1.9391639982058994e-16,
+    1.9535494676249091e-16, 1.9680159493510374e-16, 1.982565151475019e-16,
+    1.997198817949342e-16, 2.0119187299787347e-16, 2.0267267074641983e-16,
+    2.041624610503589e-16, 2.0566143409519179e-16, 2.071697844044737e-16,
+    2.08687711008816e-16, 2.1021541762192928e-16, 2.117531128241076e-16,
+    2.133010102535779e-16, 2.1485932880616633e-16, 2.1642829284376047e-16,
+    2.180081324120784e-16, 2.1959908346828707e-16, 2.212013881190496e-16,
+    2.2281529486961805e-16, 2.2444105888463086e-16, 2.2607894226131737e-16,
+    2.277292143158621e-16, 2.2939215188373114e-16, 2.3106803963482133e-16,
+    2.3275717040435346e-16, 2.344598455404958e-16, 2.361763752697774e-16,
+    2.3790707908142767e-16, 2.3965228613186235e-16, 2.4141233567062933e-16,
+    2.431875774892256e-16, 2.44978372394307e-16, 2.4678509270692887e-16,
+    2.4860812278958517e-16, 2.504478596029557e-16, 2.523047132944217e-16,
+    2.541791078205812e-16, 2.560714816061771e-16, 2.579822882420531e-16,
+    2.599119972249747e-16, 2.618610947423924e-16, 2.638300845054943e-16,
+    2.658194886341845e-16, 2.678298485979525e-16, 2.6986172621694894e-16,
+    2.7191570472798185e-16, 2.739923899205815e-16, 2.760924113487617e-16,
+    2.782164236246436e-16, 2.8036510780069835e-16, 2.825391728480253e-16,
+    2.847393572388174e-16, 2.8696643064198177e-16, 2.8922119574179956e-16,
+    2.915044901905293e-16, 2.9381718870700286e-16, 2.9616020533454657e-16,
+    2.9853449587300453e-16, 3.009410605012618e-16, 3.0338094660850034e-16,
+    3.058552518544861e-16, 3.08365127481531e-16, 3.1091178190342663e-16,
+    3.134964845996663e-16, 3.1612057034671057e-16, 3.187854438219713e-16,
+    3.2149258462067974e-16, 3.2424355273094516e-16, 3.2703999451822404e-16,
+    3.298836492772283e-16, 3.3277635641716714e-16, 3.357200633553244e-16,
+    3.387168342045505e-16, 3.417688593525637e-16, 3.448784660453424e-16,
+    3.4804813010374423e-16, 3.5128048892229794e-16, 3.545783559224792e-16,
+    3.5794473666042765e-16, 3.6138284682190606e-16, 3.6489613237645425e-16,
+    3.6848829220956213e-16, 3.7216330360802073e-16, 3.7592545104162565e-16,
+    3.7977935876688744e-16, 3.8373002787892137e-16, 3.8778287856078953e-16,
+    3.919437984311429e-16, 3.962191980786775e-16, 4.0061607510565417e-16,
+    4.051420882956573e-16, 4.0980564389030625e-16, 4.1461599642909046e-16,
+    4.195833672073399e-16, 4.247190841824385e-16, 4.3003574816674707e-16,
+    4.355474314693952e-16, 4.41269916903607e-16, 4.472209874259932e-16,
+    4.534207798565834e-16, 4.598922204905932e-16, 4.666615664711476e-16,
+    4.737590853262492e-16, 4.812199172829238e-16, 4.89085182739221e-16,
+    4.97403423619194e-16, 5.06232507214416e-16, 5.156421828878083e-16,
+    5.257175802022275e-16, 5.365640977112022e-16, 5.483144034258704e-16,
+    5.61138745467516e-16, 5.752606481503332e-16, 5.909817641652103e-16,
+    6.087231416180908e-16, 6.290979034877557e-16, 6.530492053564041e-16,
+    6.821393079028929e-16, 7.192444966089362e-16, 7.706095350032097e-16,
+    8.545517038584027e-16
+};
+
+static const double zig_exp_f[256] = {
+    1.0, 0.9381436808621746, 0.9004699299257464, 0.8717043323812036,
+    0.8477855006239896, 0.8269932966430503, 0.8084216515230084,
+    0.7915276369724956, 0.7759568520401156, 0.7614633888498963,
+    0.7478686219851951, 0.7350380924314235, 0.722867659593572,
+    0.711274760805076, 0.7001926550827882, 0.689566496117078,
+    0.6793505722647654, 0.6695063167319247, 0.6600008410789997,
+    0.650805833414571, 0.6418967164272661, 0.6332519942143661,
+    0.6248527387036659, 0.6166821809152077, 0.608725382079622,
+    0.6009689663652322, 0.5934009016917334, 0.586010318477268,
+    0.578787358602845, 0.5717230486648258, 0.5648091929124002,
+    0.5580382822625874, 0.5514034165406413, 0.5448982376724396,
+    0.5385168720028619, 0.5322538802630432, 0.5261042139836197,
+    0.5200631773682336, 0.5141263938147486, 0.5082897764106429,
+    0.5025495018413477, 0.49690198724154955, 0.49134386959403253,
+    0.4858719873418849, 0.4804833639304542, 0.4751751930373774,
+    0.46994482528396, 0.4647897562504262, 0.4597076156421377,
+    0.45469615747461545, 0.449753251162755, 0.4448768734145485,
+    0.4400651008423539, 0.4353161032156366, 0.43062813728845883,
+    0.42599954114303434, 0.4214287289976166, 0.4169141864330029,
+    0.4124544659971612, 0.4080481831520324, 0.4036940125305303,
+    0.3993906844752311, 0.39513698183329016, 0.3909317369847971,
+    0.38677382908413765, 0.38266218149600983, 0.3785957594095808,
+    0.37457356761590216, 0.370594648435146, 0.36665807978151416,
+    0.3627629733548178, 0.3589084729487498, 0.35509375286678746,
+    0.35131801643748334, 0.347580494621637, 0.3438804447045024,
+    0.34021714906678, 0.33658991402867755, 0.332998068761809,
+    0.3294409642641363, 0.3259179723935562, 0.3224284849560891,
+    0.31897191284495724, 0.31554768522712895, 0.31215524877417955,
+    0.3087940669345602, 0.30546361924459026, 0.3021634006756935,
+    0.2988929210155818, 0.2956517042812612, 0.2924392881618926,
+    0.28925522348967775, 0.2860990737370768, 0.28297041453878075,
+    0.27986883323697287, 0.27679392844851736, 0.27374530965280297,
+    0.27072259679906, 0.2677254199320448, 0.2647534188350622,
+    0.2618062426893629, 0.25888354974901623, 0.2559850070304154,
+    0.25311029001562946, 0.2502590823688623, 0.24743107566532763,
+    0.2446259691318921, 0.24184346939887721, 0.23908329026244918,
+    0.23634515245705964, 0.23362878343743335, 0.2309339171696274,
+    0.2282602939307167, 0.22560766011668407, 0.22297576805812017,
+    0.2203643758433595, 0.21777324714870053, 0.21520215107537868,
+    0.21265086199297828, 0.21011915938898826, 0.20760682772422204,
+    0.2051136562938377, 0.20263943909370902, 0.20018397469191127,
+    0.19774706610509887, 0.19532852067956322, 0.19292814997677132,
+    0.1905457696631954, 0.1881811994042543, 0.1858342627621971,
+    0.18350478709776746, 0.1811926034754963, 0.1788975465724783,
+    0.17661945459049488, 0.1743581691713535, 0.17211353531532006,
+    0.16988540130252766, 0.1676736186172502, 0.165478041874936,
+    0.16329852875190182, 0.16113493991759203, 0.1589871389693142,
+    0.15685499236936523, 0.15473836938446808, 0.15263714202744286,
+    0.1505511850010399, 0.1484803756438668, 0.14642459387834494,
+    0.14438372216063478, 0.1423576454324722, 0.14034625107486245,
+    0.1383494288635802, 0.13636707092642886, 0.13439907170221363,
+    0.13244532790138752, 0.13050573846833077, 0.12858020454522817,
+    0.12666862943751067, 0.12477091858083096, 0.12288697950954514,
+    0.12101672182667483, 0.11916005717532768, 0.11731689921155557,
+    0.11548716357863353, 0.11367076788274431, 0.1118676316700563,
+    0.11007767640518538, 0.1083008254510338, 0.10653700405000166,
+    0.10478613930657017, 0.10304816017125772, 0.10132299742595363,
+    0.09961058367063713, 0.0979108533114922, 0.0962237425504328,
+    0.09454918937605586, 0.09288713355604354, 0.09123751663104016,
+    0.08960028191003286, 0.08797537446727022, 0.08636274114075691,
+    0.08476233053236812, 0.08317409300963238, 0.08159798070923742,
+    0.0800339475423199, 0.07848194920160642, 0.0769419431704805,
+    0.07541388873405841, 0.07389774699236475, 0.07239348087570874,
+    0.07090105516237183, 0.06942043649872875, 0.0679515934219366,
+    0.06649449638533977, 0.06504911778675375, 0.06361543199980733,
+    0.062193415408540995, 0.06078304644547963, 0.059384305633420266,
+    0.05799717563120066, 0.05662164128374288, 0.05525768967669704,
+    0.05390531019604609, 0.05256449459307169, 0.05123523705512628,
+    0.04991753428270637, 0.0486113855733795, 0.04731679291318155,
+    0.04603376107617517, 0.04476229773294328, 0.04350241356888818,
+    0.042254122413316234, 0.04101744138041482, 0.039792391023374125,
+    0.03857899550307486, 0.03737728277295936, 0.03618728478193142,
+    0.03500903769739741, 0.03384258215087433, 0.032687963508959535,
+    0.03154523217289361, 0.030414443910466604, 0.029295660224637393,
+    0.028188948763978636, 0.0270943837809558, 0.026012046645134217,
+    0.024942026419731783, 0.02388442051155817, 0.02283933540638524,
+    0.02180688750428358, 0.020787204072578117, 0.019780424338009743,
+    0.01878670074469603, 0.01780620041091136, 0.016839106826039948,
+    0.015885621839973163, 0.014945968011691148, 0.014020391403181938,
+    0.013109164931254991, 0.012212592426255381, 0.011331013597834597,
+    0.010464810181029979, 0.00961441364250221, 0.008780314985808975,
+    0.00796307743801704, 0.007163353183634984, 0.006381905937319179,
+    0.005619642207205483, 0.004877655983542392, 0.004157295120833795,
+    0.003460264777836904, 0.002788798793574076, 0.0021459677437189063,
+    0.0015362997803015724, 0.0009672692823271745, 0.00045413435384149677
+};
+
+#endif
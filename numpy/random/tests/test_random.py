@@ -5,6 +5,7 @@ import numpy as np
 from numpy.testing import (
         assert_, assert_raises, assert_equal, assert_warns,
         assert_no_warnings, assert_array_equal, assert_array_almost_equal,
+        assert_allclose,
         suppress_warnings
         )
 from numpy import random
@@ -141,6 +142,473 @@ class TestSetState(object):
         self.prng.negative_binomial(0.5, 0.5)
 
 
+class TestZiggurat(object):
+    seed = 1234567890
+
+    def test_method(self):
+        assert_equal(np.random.RandomState(0).method, 'legacy')
+        assert_equal(np.random.RandomState(0, method='ziggurat').method,
+                     'ziggurat')
+        assert_raises(ValueError, np.random.RandomState, 0, method='polar')
+
+    def test_legacy_stream_unchanged(self):
+        a = np.random.RandomState(self.seed, method='legacy')
+        b = np.random.RandomState(self.seed)
+        assert_array_equal(a.standard_normal(10), b.standard_normal(10))
+        assert_array_equal(a.standard_gamma(0.5, 10),
+                           b.standard_gamma(0.5, 10))
+        # reseeding keeps the method
+        a.seed(self.seed)
+        assert_equal(a.method, 'legacy')
+
+    def test_standard_normal(self):
+        rs = np.random.RandomState(self.seed, method='ziggurat')
+        actual = rs.standard_normal(size=(3, 2))
+        desired = np.array([[-3.472754000610961, -0.1089385642291426],
+                            [-0.24596575339641147, -0.7041015502617014],
+                            [0.36010248711635573, 0.12783210177236684]])
+        assert_array_almost_equal(actual, desired, decimal=15)
+
+    def test_standard_exponential(self):
+        rs = np.random.RandomState(self.seed, method='ziggurat')
+        actual = rs.standard_exponential(size=(3, 2))
+        desired = np.array([[4.76293603146487, 0.453284341823815],
+                            [0.7197961380938054, 2.041391826843294],
+                            [0.4150585820325213, 1.3896384241905435]])
+        assert_array_almost_equal(actual, desired, decimal=15)
+
+    def test_standard_gamma(self):
+        rs = np.random.RandomState(self.seed, method='ziggurat')
+        actual = rs.standard_gamma(0.5, size=(3, 2))
+        desired = np.array([[0.30605827009106074, 0.00656701530573163],
+                            [4.449470712933323, 0.2203773846152888],
+                            [0.09991675172218925, 2.685211096024018]])
+        assert_array_almost_equal(actual, desired, decimal=14)
+        assert_equal(rs.standard_gamma(0), 0)
+
+    def test_moments(self):
+        rs = np.random.RandomState(self.seed, method='ziggurat')
+        n = 10**6
+        x = rs.standard_normal(n)
+        assert_(abs(x.mean()) < 5e-3)
+        assert_(abs(x.var() - 1) < 5e-3)
+        assert_(abs((x**4).mean() - 3) < 5e-2)
+        # the tail beyond the base strip, P(|x| > 3.654) = 2.58e-4
+        assert_(abs((abs(x) > 3.6541528853610088).mean() - 2.58e-4) < 5e-5)
+        e = rs.standard_exponential(n)
+        assert_(abs(e.mean() - 1) < 5e-3)
+        assert_(abs(e.var() - 1) < 1e-2)
+        for shape in [0.25, 1.0, 4.0]:
+            g = rs.standard_gamma(shape, n)
+            assert_(abs(g.mean() - shape) < 1e-2*max(shape, 1))
+            assert_(abs(g.var() - shape) < 3e-2*max(shape, 1))
+
+
+class TestBitGenerators(object):
+    seed = 1234
+    names = ['PCG64', 'Philox', 'Xoshiro256']
+
+    def _uint64(self, rs, n):
+        return [int(x) for x in rs.randint(0, 2**64, size=n, dtype=np.uint64)]
+
+    def _set_words(self, rs, words, pos=4):
+        state = rs.get_state()
+        rs.set_state((state[0], np.array(words, np.uint64), pos) +
+                     state[3:5] + (0, 0))
+
+    def test_bit_generator(self):
+        assert_equal(np.random.RandomState(0).bit_generator, 'MT19937')
+        for name in self.names:
+            rs = np.random.RandomState(0, bit_generator=name)
+            assert_equal(rs.bit_generator, name)
+            rs.seed(1)
+            assert_equal(rs.bit_generator, name)
+        assert_raises(ValueError, np.random.RandomState, 0,
+                      bit_generator='MT')
+
+    def test_pcg64_reference(self):
+        # pcg64 seeded with srandom(42, 54) in the reference implementation
+        mult = (2549297995355413924 << 64) + 4865540595714422341
+        mod = 2**128
+        inc = (54 << 1) | 1
+        state = inc
+        state = ((state + 42)*mult + inc) % mod
+        rs = np.random.RandomState(0, bit_generator='PCG64')
+        self._set_words(rs, [state >> 64, state % 2**64,
+                             inc >> 64, inc % 2**64])
+        assert_equal(self._uint64(rs, 4),
+                     [0x86b1da1d72062b68, 0x1304aa46c9853d39,
+                      0xa3670e9e0dd50358, 0xf9090e529a7dae00])
+
+    def test_philox_reference(self):
+        # known answers of Random123 for counters 0 and pi, the counter
+        # is incremented before each block
+        m = 2**64 - 1
+        rs = np.random.RandomState(0, bit_generator='Philox')
+        self._set_words(rs, [m, m, m, m] + [0]*6)
+        assert_equal(self._uint64(rs, 4),
+                     [0x16554d9eca36314c, 0xdb20fe9d672d0fdc,
+                      0xd7e772cee186176b, 0x7e68b68aec7ba23b])
+        self._set_words(rs, [0x243f6a8885a308d2, 0x13198a2e03707344,
+                             0xa4093822299f31d0, 0x082efa98ec4e6c89,
+                             0x452821e638d01377, 0xbe5466cf34e90c6c,
+                             0, 0, 0, 0])
+        assert_equal(self._uint64(rs, 4),
+                     [0xa528f45403e61d95, 0x38c72dbd566e9788,
+                      0xa5a1610e72fd18b5, 0x57bd43b5e52b7fe6])
+
+    def test_xoshiro256_reference(self):
+        def rotl(x, k):
+            return ((x << k) | (x >> (64 - k))) % 2**64
+
+        s = [1, 2, 3, 4]
+        desired = []
+        for i in range(5):
+            desired.append(rotl(s[1]*5 % 2**64, 7)*9 % 2**64)
+            t = (s[1] << 17) % 2**64
+            s[2] ^= s[0]
+            s[3] ^= s[1]
+            s[1] ^= s[2]
+            s[0] ^= s[3]
+            s[2] ^= t
+            s[3] = rotl(s[3], 45)
+        rs = np.random.RandomState(0, bit_generator='Xoshiro256')
+        self._set_words(rs, [1, 2, 3, 4])
+        assert_equal(self._uint64(rs, 5), desired)
+
+    def test_seeded_streams(self):
+        desired = {
+            'PCG64': ([0.8876570413766435, 0.7210334593277594,
+                       0.5200630007594628],
+                      [1090749979, 1760219446, 2884019113]),
+            'Philox': ([0.7063572891126949, 0.9083233005113077,
+                        0.8656898952975286],
+                       [2793313349, 976424406, 373842688]),
+            'Xoshiro256': ([0.34649523504763613, 0.5927479828212665,
+                            0.28797234404571337],
+                           [4250209313, 4117355375, 157597641])}
+        for name, (doubles, ints) in desired.items():
+            rs = np.random.RandomState(self.seed, bit_generator=name)
+            assert_array_almost_equal(rs.random_sample(3), doubles,
+                                      decimal=15)
+            assert_array_equal(rs.randint(2**32, size=3, dtype=np.uint32),
+                               ints)
+
+    def test_state_roundtrip(self):
+        for name in self.names:
+            rs = np.random.RandomState(self.seed, bit_generator=name)
+            # leave half a 64 bit draw and a gaussian pending
+            rs.randint(2**32, dtype=np.uint32)
+            rs.standard_normal()
+            state = rs.get_state()
+            assert_equal(state[0], name)
+            assert_equal(state[5], 1)
+            desired = rs.randint(2**32, size=7, dtype=np.uint32)
+            desired_normal = rs.standard_normal(3)
+            # set_state switches the generator
+            other = np.random.RandomState(0)
+            other.set_state(state)
+            assert_equal(other.bit_generator, name)
+            assert_array_equal(other.randint(2**32, size=7, dtype=np.uint32),
+                               desired)
+            assert_array_equal(other.standard_normal(3), desired_normal)
+            other.set_state(np.random.RandomState(0).get_state())
+            assert_equal(other.bit_generator, 'MT19937')
+            assert_raises(ValueError, rs.set_state, state[:5])
+            assert_raises(ValueError, rs.set_state,
+                          (name, state[1][:2]) + state[2:])
+
+    def test_moments(self):
+        for name in self.names:
+            for method in ['legacy', 'ziggurat']:
+                rs = np.random.RandomState(self.seed, method=method,
+                                           bit_generator=name)
+                u = rs.random_sample(10**5)
+                assert_(abs(u.mean() - 0.5) < 5e-3)
+                assert_(abs(u.var() - 1/12) < 2e-3)
+                x = rs.standard_normal(10**5)
+                assert_(abs(x.mean()) < 2e-2)
+                assert_(abs(x.var() - 1) < 2e-2)
+                b = rs.randint(2, size=10**5).astype(float)
+                assert_(abs(b.mean() - 0.5) < 1e-2)
+
+    def test_bounded_integers(self):
+        # Lemire's method, the high word of x*(high - low)
+        desired = {'PCG64': ([887, 721, 520, 409],
+                             [471088449707, 667383273645], [35, 36, 43]),
+                   'Philox': ([706, 908, 865, 227],
+                              [324031849238, 942755010807], [48, 5, 17]),
+                   'Xoshiro256': ([346, 592, 287, 958],
+                                  [767053402633, 871948708223],
+                                  [12, 63, 89])}
+        for name in self.names:
+            rs = np.random.RandomState(self.seed, bit_generator=name)
+            small, large, int32 = desired[name]
+            assert_array_equal(rs.randint(1000, size=4), small)
+            assert_array_equal(rs.randint(2**40, size=2, dtype=np.uint64),
+                               large)
+            assert_array_equal(rs.randint(-5, 100, size=3, dtype=np.int32),
+                               int32)
+            counts = np.bincount(rs.randint(3, size=30000), minlength=3)
+            assert_(np.all(abs(counts - 10000) < 500))
+            top = rs.randint(3*2**62, size=30000, dtype=np.uint64) >> 62
+            counts = np.bincount(top.astype(np.intp), minlength=3)
+            assert_(np.all(abs(counts - 10000) < 500))
+
+    def test_fill_matches_scalar(self):
+        # the bulk fills give the values of repeated scalar draws
+        args = {'random_sample': (), 'standard_normal': (),
+                'standard_exponential': (), 'normal': (1.5, 2.0),
+                'uniform': (-1.0, 3.0)}
+        for name in ['MT19937'] + self.names:
+            for method in ['legacy', 'ziggurat']:
+                for func, a in args.items():
+                    # start at an odd position in the blocks of words and
+                    # with a cached gaussian
+                    for pre in [0, 311]:
+                        rs = [np.random.RandomState(self.seed, method=method,
+                                                    bit_generator=name)
+                              for i in range(2)]
+                        for r in rs:
+                            r.randint(2**32, size=pre, dtype=np.uint32)
+                            r.standard_normal()
+                        actual = np.concatenate(
+                            [getattr(rs[0], func)(*a, size=7),
+                             getattr(rs[0], func)(*a, size=700)])
+                        desired = [getattr(rs[1], func)(*a)
+                                   for i in range(707)]
+                        assert_array_equal(actual, desired)
+
+
+class TestJump(object):
+    seed = 1234
+    names = ['MT19937', 'PCG64', 'Philox', 'Xoshiro256']
+
+    def test_jump(self):
+        desired = {'MT19937': [2420717291, 4119246277, 3052165451],
+                   'PCG64': [2508818948, 1873346384, 2761887141],
+                   'Philox': [737887566, 119042833, 3306649195],
+                   'Xoshiro256': [97815656, 1814215077, 3122636454]}
+        for name in self.names:
+            rs = np.random.RandomState(self.seed, bit_generator=name)
+            rs.jump()
+            assert_array_equal(rs.randint(2**32, size=3, dtype=np.uint32),
+                               desired[name])
+            assert_raises(ValueError, rs.jump, -1)
+
+    def test_jump_count(self):
+        for name in self.names:
+            a = np.random.RandomState(self.seed, bit_generator=name)
+            b = np.random.RandomState(self.seed, bit_generator=name)
+            a.jump(0)
+            assert_array_equal(a.get_state()[1], b.get_state()[1])
+            a.jump(2)
+            b.jump()
+            b.jump()
+            assert_array_equal(a.random_sample(5), b.random_sample(5))
+
+    def test_jump_discards_cache(self):
+        for name in self.names:
+            rs = np.random.RandomState(self.seed, bit_generator=name)
+            rs.standard_normal()
+            rs.randint(2**32, dtype=np.uint32)
+            rs.jump()
+            state = rs.get_state()
+            assert_equal(state[3], 0)
+            if name != 'MT19937':
+                assert_equal(state[5], 0)
+
+    def test_pcg64_advance(self):
+        mult = (2549297995355413924 << 64) + 4865540595714422341
+        delta = 0x9e3779b97f4a7c15f39cc0605cedc835
+        mod = 2**128
+        rs = np.random.RandomState(self.seed, bit_generator='PCG64')
+        words = [int(w) for w in rs.get_state()[1]]
+        state = (words[0] << 64) + words[1]
+        inc = (words[2] << 64) + words[3]
+        # state*mult**delta + inc*(mult**delta - 1)/(mult - 1) by squaring
+        acc_mult, acc_plus = 1, 0
+        while delta:
+            if delta & 1:
+                acc_mult = acc_mult*mult % mod
+                acc_plus = (acc_plus*mult + inc) % mod
+            inc = (mult + 1)*inc % mod
+            mult = mult*mult % mod
+            delta >>= 1
+        state = (acc_mult*state + acc_plus) % mod
+        rs.jump()
+        assert_equal([int(w) for w in rs.get_state()[1][:2]],
+                     [state >> 64, state % 2**64])
+
+    def test_philox_counter(self):
+        rs = np.random.RandomState(self.seed, bit_generator='Philox')
+        rs.random_sample()
+        ctr = rs.get_state()[1][:4].copy()
+        rs.jump()
+        state = rs.get_state()
+        assert_array_equal(state[1][:4], ctr + np.array([0, 0, 1, 0],
+                                                        np.uint64))
+        assert_equal(state[2], 4)
+
+    def test_spawn(self):
+        for name in self.names:
+            for method in ['legacy', 'ziggurat']:
+                parent = np.random.RandomState(self.seed, method=method,
+                                               bit_generator=name)
+                children = parent.spawn(3)
+                assert_equal(len(children), 3)
+                for i, child in enumerate(children + [parent]):
+                    assert_equal(child.bit_generator, name)
+                    assert_equal(child.method, method)
+                    reference = np.random.RandomState(
+                        self.seed, method=method, bit_generator=name)
+                    reference.jump(i)
+                    assert_array_equal(child.standard_normal(5),
+                                       reference.standard_normal(5))
+        assert_equal(np.random.RandomState(0).spawn(0), [])
+        assert_raises(ValueError, np.random.RandomState(0).spawn, -1)
+
+
+class TestParallelFill(object):
+    seed = 1234
+    chunk = 65536
+
+    def _draws(self, threads, method='legacy', bit_generator='MT19937'):
+        rs = np.random.RandomState(self.seed, method=method,
+                                   bit_generator=bit_generator)
+        return [rs.random_sample(threads=threads),
+                rs.random_sample((3, 5), threads=threads),
+                rs.standard_normal(2*self.chunk + 1, threads=threads),
+                rs.normal(2.0, 3.0, 10, threads=threads),
+                rs.uniform(-1.0, 2.0, self.chunk, threads=threads),
+                rs.standard_exponential(self.chunk + 3, threads=threads)]
+
+    def test_thread_independent(self):
+        for bit_generator in ['MT19937', 'PCG64', 'Philox', 'Xoshiro256']:
+            for method in ['legacy', 'ziggurat']:
+                desired = self._draws(1, method, bit_generator)
+                assert_(isinstance(desired[0], float))
+                for threads in [2, 3, 8]:
+                    actual = self._draws(threads, method, bit_generator)
+                    for a, d in zip(actual, desired):
+                        assert_array_equal(a, d)
+
+    def test_substreams(self):
+        # chunk k comes from a generator seeded with 8 words of the parent
+        # followed by k as two 32 bit words
+        for bit_generator in ['MT19937', 'PCG64']:
+            rs = np.random.RandomState(self.seed,
+                                       bit_generator=bit_generator)
+            key = rs.randint(2**32, size=8, dtype=np.uint32)
+            actual = np.random.RandomState(
+                self.seed, bit_generator=bit_generator).standard_normal(
+                    2*self.chunk + 5, threads=2)
+            for k in range(3):
+                sub = np.random.RandomState(list(key) + [k, 0],
+                                            bit_generator=bit_generator)
+                n = min(self.chunk, actual.size - k*self.chunk)
+                assert_array_equal(actual[k*self.chunk:k*self.chunk + n],
+                                   sub.standard_normal(n))
+
+    def test_streams_differ(self):
+        # each call draws new substreams, unrelated to the single stream
+        rs = np.random.RandomState(self.seed)
+        actual = rs.standard_normal(3, threads=4)
+        desired = rs.standard_normal(3, threads=1)
+        assert_(not np.array_equal(actual, desired))
+        assert_(not np.array_equal(
+            np.random.RandomState(self.seed).standard_normal(3, threads=1),
+            np.random.RandomState(self.seed).standard_normal(3)))
+
+    def test_errors(self):
+        rs = np.random.RandomState(self.seed)
+        assert_raises(ValueError, rs.random_sample, 3, threads=0)
+        assert_raises(TypeError, rs.random_sample, 3, threads=1.5)
+        assert_raises(ValueError, rs.normal, [0, 1], 1, threads=2)
+        assert_raises(ValueError, rs.uniform, 0, [1, 2], threads=2)
+
+
+class TestSinglePrecision(object):
+    seed = 1234
+    bit_generators = ['MT19937', 'PCG64', 'Philox', 'Xoshiro256']
+
+    def test_random_sample(self):
+        # the upper 24 bits of successive 32 bit draws
+        for bit_generator in self.bit_generators:
+            rs = np.random.RandomState(self.seed, bit_generator=bit_generator)
+            actual = np.concatenate([rs.random_sample(1, dtype=np.float32),
+                                     rs.random_sample(100, dtype=np.float32),
+                                     rs.random_sample(7, dtype='f4')])
+            assert_equal(actual.dtype, np.float32)
+            rs = np.random.RandomState(self.seed, bit_generator=bit_generator)
+            if bit_generator == 'MT19937':
+                bits = rs.randint(2**32, size=108, dtype=np.uint32)
+            else:
+                bits = rs.randint(2**64, size=54, dtype=np.uint64)
+                bits = np.column_stack((bits & 0xffffffff, bits >> 32))
+            assert_array_equal(actual, (bits.ravel() >> 8) / 2.0**24)
+
+        rs = np.random.RandomState(self.seed)
+        assert_(isinstance(rs.random_sample(dtype=np.float32), np.float32))
+        assert_equal(rs.random_sample((2, 3), dtype=np.float32).shape, (2, 3))
+        assert_(isinstance(rs.random_sample(dtype=np.float64), float))
+
+    def test_distributions(self):
+        for bit_generator in self.bit_generators:
+            rs = np.random.RandomState(self.seed, bit_generator=bit_generator)
+            x = rs.standard_normal(10**5, dtype=np.float32)
+            assert_equal(x.dtype, np.float32)
+            assert_(abs(x.mean()) < 0.02 and abs(x.var() - 1) < 0.02)
+            assert_(abs((x > 2).mean() - 0.02275) < 0.002)
+            x = rs.standard_exponential(10**5, dtype=np.float32)
+            assert_equal(x.dtype, np.float32)
+            assert_(x.min() >= 0)
+            assert_(abs(x.mean() - 1) < 0.02 and abs(x.var() - 1) < 0.04)
+            assert_(abs((x > 3).mean() - np.exp(-3)) < 0.002)
+
+        # the float32 ziggurat does not depend on the method
+        for f in ['standard_normal', 'standard_exponential']:
+            actual = [getattr(np.random.RandomState(self.seed, method=m), f)(
+                      10, dtype=np.float32) for m in ['legacy', 'ziggurat']]
+            assert_array_equal(actual[0], actual[1])
+
+    def test_uniform(self):
+        rs = np.random.RandomState(self.seed)
+        x = rs.uniform(-2, 3, 1000, dtype=np.float32)
+        assert_equal(x.dtype, np.float32)
+        assert_(x.min() >= -2 and x.max() < 3)
+        assert_(isinstance(rs.uniform(dtype=np.float32), np.float32))
+        x = rs.uniform([0, 10], [1, 20], dtype=np.float32)
+        assert_equal(x.dtype, np.float32)
+        assert_((x >= [0, 10]).all() and (x < [1, 20]).all())
+        assert_equal(rs.uniform(0, [1, 2], (3, 2), dtype=np.float32).shape,
+                     (3, 2))
+
+        # narrow intervals far from 0 round to high in single precision
+        for low, high in [(1e6, 1e6 + 1), (1e6, 1e6 + 0.1), (-1e6 - 1, -1e6)]:
+            x = rs.uniform(low, high, 1000, dtype=np.float32)
+            assert_((x.astype(np.float64) < high).all())
+            assert_((x >= np.float32(low)).all())
+            x = rs.uniform([low, 0], [high, 1], (1000, 2), dtype=np.float32)
+            assert_((x.astype(np.float64) < [high, 1]).all())
+
+    def test_threads(self):
+        for f in ['random_sample', 'standard_normal', 'standard_exponential']:
+            desired = getattr(np.random.RandomState(self.seed), f)(
+                70000, threads=1, dtype=np.float32)
+            actual = getattr(np.random.RandomState(self.seed), f)(
+                70000, threads=3, dtype=np.float32)
+            assert_equal(actual.dtype, np.float32)
+            assert_array_equal(actual, desired)
+
+    def test_errors(self):
+        rs = np.random.RandomState(self.seed)
+        for f in [rs.random_sample, rs.standard_normal, rs.standard_exponential,
+                  rs.uniform]:
+            assert_raises(TypeError, f, size=3, dtype=np.int32)
+            assert_raises(TypeError, f, size=3, dtype=np.float16)
+
+
 class TestRandint(object):
 
     rfunc = np.random.randint
@@ -383,6 +851,78 @@ class TestRandomDist(object):
         desired = np.array([2, 3, 1])
         assert_array_equal(actual, desired)
 
+    def test_choice_noreplace_sampling(self):
+        # MT19937 keeps the permutation, the other generators use Floyd's
+        # algorithm for large populations and a partial shuffle otherwise
+        np.random.seed(self.seed)
+        assert_array_equal(np.random.choice(50, 7, replace=False),
+                           np.random.RandomState(self.seed).permutation(50)[:7])
+        rs = np.random.RandomState(1234, bit_generator='PCG64')
+        assert_array_equal(rs.choice(10**9, 5, replace=False),
+                           [115117574, 591232490, 577556715, 949331479,
+                            521907718])
+        assert_array_equal(rs.choice(20, 5, replace=False), [8, 1, 12, 19, 14])
+        # the method can be chosen with any generator
+        rs = np.random.RandomState(1234, bit_generator='PCG64')
+        assert_array_equal(rs.choice(10**9, 5, replace=False, method='floyd'),
+                           [115117574, 591232490, 577556715, 949331479,
+                            521907718])
+        x = np.random.RandomState(self.seed).choice(10**12, 5, replace=False,
+                                                    method='floyd')
+        assert_equal(len(np.unique(x)), 5)
+        assert_(x.min() >= 0 and x.max() < 10**12)
+        rs = np.random.RandomState(1234, bit_generator='PCG64')
+        assert_array_equal(rs.choice(50, 7, replace=False,
+                                     method='permutation'),
+                           np.random.RandomState(
+                               1234, bit_generator='PCG64').permutation(50)[:7])
+        assert_raises(ValueError, rs.choice, 5, 2, replace=False,
+                      method='shuffle')
+        for n, k in [(1000, 60), (10**12, 1000), (64, 4), (10, 10)]:
+            x = rs.choice(n, k, replace=False)
+            assert_equal(len(np.unique(x)), k)
+            assert_(x.min() >= 0 and x.max() < n)
+        # all ordered pairs of distinct values equally likely
+        for n in [5, 40]:
+            x = np.array([rs.choice(n, 2, replace=False)
+                          for i in range(20000)])
+            counts = np.bincount(x[:, 0]*n + x[:, 1], minlength=n*n)
+            assert_equal(counts[::n + 1], 0)
+            expected = 20000/(n*(n - 1))
+            assert_(np.all(abs(np.delete(counts, np.s_[::n + 1]) - expected)
+                           < 6*np.sqrt(expected)))
+
+    def test_alias_sampler(self):
+        sampler = np.random.RandomState(1234).alias_sampler(
+            4, [0.1, 0.2, 0.3, 0.4])
+        assert_array_equal(sampler.sample(8), [3, 1, 3, 1, 2, 2, 2, 3])
+        assert_equal(sampler.sample(), 1)
+        assert_(np.isscalar(sampler.sample()))
+        assert_equal(sampler.sample((2, 3)).shape, (2, 3))
+
+        p = np.random.RandomState(0).random_sample(7)
+        p /= p.sum()
+        p[3] = 0
+        p /= p.sum()
+        sampler = np.random.RandomState(1).alias_sampler(7, p)
+        freq = np.bincount(sampler.sample(10**5), minlength=7)/10**5
+        assert_equal(freq[3], 0)
+        assert_(np.all(abs(freq - p) < 5e-3))
+
+        sampler = np.random.alias_sampler(['a', 'b', 'c'], [0.5, 0, 0.5])
+        assert_(sampler.sample() in ('a', 'c'))
+        assert_(set(sampler.sample(20)) <= set(['a', 'c']))
+        actual = sampler.sample(())
+        assert_equal(actual.shape, ())
+        assert_(actual in ('a', 'c'))
+
+        rs = np.random.RandomState(0)
+        assert_raises(ValueError, rs.alias_sampler, -1, [1])
+        assert_raises(ValueError, rs.alias_sampler, [], [])
+        assert_raises(ValueError, rs.alias_sampler, [1, 2], [0.4, 0.4, 0.2])
+        assert_raises(ValueError, rs.alias_sampler, [1, 2], [1.1, -0.1])
+        assert_raises(ValueError, rs.alias_sampler, [1, 2], [0.4, 0.4])
+
     def test_choice_noninteger(self):
         np.random.seed(self.seed)
         actual = np.random.choice(['a', 'b', 'c', 'd'], 4)
@@ -700,6 +1240,43 @@ class TestRandomDist(object):
         assert_raises(ValueError, np.random.multivariate_normal, mean, cov,
                       check_valid='raise')
 
+    def test_multivariate_normal_sampler(self):
+        mean = [0.5, -1., 2.]
+        cov = [[2., 0.5, 0.1], [0.5, 1., 0.2], [0.1, 0.2, 0.5]]
+        # the svd factor reproduces multivariate_normal
+        np.random.seed(self.seed)
+        desired = np.random.multivariate_normal(mean, cov, (3, 2))
+        np.random.seed(self.seed)
+        sampler = np.random.multivariate_normal_sampler(mean, cov,
+                                                        method='svd')
+        assert_array_equal(sampler.sample((3, 2)), desired)
+        assert_equal(sampler.sample().shape, (3,))
+        assert_equal(sampler.sample(4).shape, (4, 3))
+
+        for method in ['cholesky', 'eigh', 'svd']:
+            sampler = np.random.RandomState(self.seed).\
+                multivariate_normal_sampler(mean, cov, method=method)
+            x = sampler.sample(10**5)
+            assert_allclose(x.mean(axis=0), mean, atol=0.02)
+            assert_allclose(np.cov(x.T), cov, atol=0.03)
+
+        # singular covariances fall back on eigh
+        x = np.random.multivariate_normal_sampler(
+            [0, 0], [[1, 1], [1, 1]], check_valid='raise').sample(5)
+        assert_array_almost_equal(x[:, 0], x[:, 1], decimal=12)
+
+        for cov in [[[1, 2], [2, 1]], [[1, 0.5], [0, 1]]]:
+            assert_warns(RuntimeWarning, np.random.multivariate_normal_sampler,
+                         [0, 0], cov)
+            assert_no_warnings(np.random.multivariate_normal_sampler,
+                               [0, 0], cov, check_valid='ignore')
+            assert_raises(ValueError, np.random.multivariate_normal_sampler,
+                          [0, 0], cov, check_valid='raise')
+        assert_raises(ValueError, np.random.multivariate_normal_sampler,
+                      [0, 0], np.eye(2), method='qr')
+        assert_raises(ValueError, np.random.multivariate_normal_sampler,
+                      [0, 0, 0], np.eye(2))
+
     def test_negative_binomial(self):
         np.random.seed(self.seed)
         actual = np.random.negative_binomial(n=100, p=.12345, size=(3, 2))